@@ -0,0 +1,423 @@
+#ifndef CSV_H
+#define CSV_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h> // size_t
+#include <stdbool.h> // bool
+#include <stdint.h> // uint64_t
+
+#define STRING_VIEW_IMPLEMENTATION
+#include "./string_view.h"
+
+/**
+ * @brief A streaming parser of delimited records, such as comma- or tab-separated values. Records end at a line feed, and fields are views into the parsed text; only a quoted field containing an escaped quote is unescaped into blocks owned by the parser, which are reused once the next record is started. The delimetres, line feeds and quotes of a window of 64 charactors are found at once and kept as two bit masks, so most fields are found without reading the text again.
+ */
+typedef struct
+{
+    string_t rest;
+    char delimetre;
+    bool in_record;
+    const char *window;
+    size_t window_size;
+    uint64_t separators;
+    uint64_t quotes;
+    char **blocks;
+    size_t block_count;
+    size_t block_capacity;
+    size_t block_used;
+    size_t block_size;
+} csv_t;
+
+/**
+ * @brief Construct a new parser over the records of a text separated by a given delimetre.
+ * @param text Text to parse. The text is not copied, so it must outlive the parser and every field obtained from it.
+ * @param delimetre Charactor which separates the fields of a record, such as `,` or `\t`.
+ * @returns A new parser.
+ */
+csv_t csv_new(string_t text, char delimetre);
+
+/**
+ * @brief Advance the parser to the next record. The fields of the current record which have not been obtained are skipped, and any of its unescaped fields are invalidated.
+ * @param csv A pointer to the parser.
+ * @returns True if there is another record, else false once the text has been parsed.
+ */
+bool csv_next_record(csv_t *csv);
+
+/**
+ * @brief Obtain the next field of the current record. A field within quotes may contain the delimetre, line feeds, and quotes escaped by doubling them, and its quotes are removed. A carriage return before a line feed is left out of the last field, so both `\n` and `\r\n` endings are handled.
+ * @param csv A pointer to the parser.
+ * @param field A pointer to which to write the field. The field remains valid until the next record is started.
+ * @returns True if a field was written, else false once every field of the record has been obtained.
+ * @exception If a field must be unescaped and a block can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+bool csv_next_field(csv_t *csv, string_t *field);
+
+/**
+ * @brief Deallocate the blocks of the parser, which invalidates every unescaped field.
+ * @param csv A pointer to the parser to deallocate.
+ */
+void csv_delete(csv_t *csv);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // CSV_H
+
+#if defined(CSV_IMPLEMENTATION) && !defined(CSV_IMPLEMENTED)
+#define CSV_IMPLEMENTED
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdlib.h> // malloc, realloc, free, exit
+#include <stdio.h> // fprintf, stderr
+#include <string.h> // memcpy, memset
+
+#ifndef CSV_QUOTE
+#define CSV_QUOTE '"'
+#endif // CSV_QUOTE
+
+#ifndef CSV_BLOCK_SIZE
+#define CSV_BLOCK_SIZE (4 * 1024)
+#endif // CSV_BLOCK_SIZE
+
+/**
+ * @brief Reserve room for a given number of charactors within the blocks of the parser. A new block, at least twice as large as the last, is started when the charactors do not fit within the current one, so earlier fields never move.
+ * @param csv Parser within which to reserve.
+ * @param count Number of charactors.
+ * @returns A pointer to the reserved charactors.
+ * @exception If a block can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static char *_csv_reserve(csv_t *csv, size_t count)
+{
+    if (csv->block_count == 0 || csv->block_size - csv->block_used < count)
+    {
+        if (csv->block_count >= csv->block_capacity)
+        {
+            const size_t capacity = csv->block_capacity ? csv->block_capacity * 2 : 8;
+            char **blocks = (char **)realloc(csv->blocks, capacity * sizeof(char *));
+            if (NULL == blocks)
+            {
+                fprintf(stderr, "AllocationError: Can not reallocate the blocks of the parser.\n");
+                exit(1);
+            }
+            csv->blocks = blocks;
+            csv->block_capacity = capacity;
+        }
+        size_t size = csv->block_size ? csv->block_size * 2 : CSV_BLOCK_SIZE;
+        if (size < count)
+        {
+            size = count;
+        }
+        char *block = (char *)malloc(size);
+        if (NULL == block)
+        {
+            fprintf(stderr, "AllocationError: Can not allocate a block for the fields of the parser.\n");
+            exit(1);
+        }
+        csv->blocks[csv->block_count++] = block;
+        csv->block_used = 0;
+        csv->block_size = size;
+    }
+    char *data = csv->blocks[csv->block_count - 1] + csv->block_used;
+    csv->block_used += count;
+    return data;
+}
+
+/**
+ * @brief Release the fields unescaped for the previous record. Only the last block, which is the largest, is kept, so a parser settles on a single block.
+ * @param csv Parser whose blocks to release.
+ */
+static void _csv_release(csv_t *csv)
+{
+    if (csv->block_count > 1)
+    {
+        for (size_t i = 0; i + 1 < csv->block_count; ++i)
+        {
+            free(csv->blocks[i]);
+        }
+        csv->blocks[0] = csv->blocks[csv->block_count - 1];
+        csv->block_count = 1;
+    }
+    csv->block_used = 0;
+}
+
+/**
+ * @brief Count the trailing zero bits of a non-zero 64-bit integer.
+ * @param value The integer, which must not be zero.
+ * @returns The number of trailing zero bits.
+ */
+static int _csv_trailing_zeroes(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int zeroes = 0;
+    for (; !(value & 1); value >>= 1)
+    {
+        zeroes++;
+    }
+    return zeroes;
+#endif
+}
+
+/**
+ * @brief Move the window of the parser to a given charactor, marking the separators — the delimetre and the line feed — and the quotes among the next 64 charactors, or fewer at the end of the text.
+ * @param csv Parser whose window to move.
+ * @param window Pointer to the first charactor of the window.
+ * @param count Number of charactors within the window, which must be between 1 and 64.
+ */
+static void _csv_classify(csv_t *csv, const char *window, size_t count)
+{
+    uint64_t separators = 0;
+    uint64_t quotes = 0;
+#if STRING_VIEW_SIMD
+    // A window at the end of the text is copied, so that no charactor past its end is read.
+    char padded[64];
+    const char *data = window;
+    if (count < 64)
+    {
+        memset(padded, 0, sizeof(padded));
+        memcpy(padded, window, count);
+        data = padded;
+    }
+    const __m128i delimetre = _mm_set1_epi8(csv->delimetre);
+    const __m128i line_feed = _mm_set1_epi8('\n');
+    const __m128i quote = _mm_set1_epi8(CSV_QUOTE);
+    for (size_t i = 0; i < 64; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128((const __m128i *) (data + i));
+        const __m128i separator = _mm_or_si128(_mm_cmpeq_epi8(block, delimetre), _mm_cmpeq_epi8(block, line_feed));
+        separators |= (uint64_t) (unsigned int) _mm_movemask_epi8(separator) << i;
+        quotes |= (uint64_t) (unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(block, quote)) << i;
+    }
+    if (count < 64)
+    {
+        const uint64_t valid = ((uint64_t) 1 << count) - 1;
+        separators &= valid;
+        quotes &= valid;
+    }
+#else
+    for (size_t i = 0; i < count; ++i)
+    {
+        separators |= (uint64_t) (window[i] == csv->delimetre || window[i] == '\n') << i;
+        quotes |= (uint64_t) (window[i] == CSV_QUOTE) << i;
+    }
+#endif // STRING_VIEW_SIMD
+    csv->window = window;
+    csv->window_size = count;
+    csv->separators = separators;
+    csv->quotes = quotes;
+}
+
+/**
+ * @brief Find the next separator or quote of the text, moving the window of the parser forwards when the charactor is past it.
+ * @param csv Parser within whose text to search.
+ * @param from Pointer to the charactor from which to search.
+ * @param quote Whether to find a quote rather than a separator.
+ * @returns A pointer to the charactor that was found, or to the end of the text.
+ */
+static const char *_csv_find(csv_t *csv, const char *from, bool quote)
+{
+    const char *end = csv->rest.data + csv->rest.count;
+    while (from < end)
+    {
+        if (from < csv->window || (size_t) (from - csv->window) >= csv->window_size)
+        {
+            const size_t remaining = (size_t) (end - from);
+            _csv_classify(csv, from, remaining < 64 ? remaining : 64);
+        }
+        const size_t offset = (size_t) (from - csv->window);
+        const uint64_t mask = (quote ? csv->quotes : csv->separators) >> offset;
+        if (mask)
+        {
+            return from + _csv_trailing_zeroes(mask);
+        }
+        from = csv->window + csv->window_size;
+    }
+    return end;
+}
+
+/**
+ * @brief Find the closing quote of a quoted field.
+ * @param csv Parser within whose text to search.
+ * @param escaped A pointer to which to write whether the field contains an escaped quote.
+ * @returns The index of the closing quote from the opening quote at the front of the text, or the number of charactors left if the field is never closed.
+ */
+static size_t _csv_find_closing_quote(csv_t *csv, bool *escaped)
+{
+    const char *data = csv->rest.data;
+    const size_t count = csv->rest.count;
+    *escaped = false;
+    size_t i = 1;
+    for (;;)
+    {
+        i = (size_t) (_csv_find(csv, data + i, true) - data);
+        if (i + 1 < count && data[i + 1] == CSV_QUOTE)
+        {
+            *escaped = true;
+            i += 2;
+            continue;
+        }
+        return i;
+    }
+}
+
+/**
+ * @brief Copy the content of a quoted field with every escaped quote replaced by a single quote.
+ * @param destination Pointer to which to copy.
+ * @param data Pointer to the first charactor after the opening quote.
+ * @param count Number of charactors up to the closing quote, within which every quote is doubled.
+ * @returns The number of copied charactors.
+ */
+static size_t _csv_unescape(char *destination, const char *data, size_t count)
+{
+    size_t length = 0;
+    size_t i = 0;
+    while (i < count)
+    {
+        const string_t rest = string_new(data + i, count - i);
+        size_t quote = string_find_first_of(&rest, CSV_QUOTE);
+        if (quote == STRING_NOT_FOUND)
+        {
+            quote = count - i;
+        }
+        memcpy(destination + length, data + i, quote);
+        length += quote;
+        i += quote;
+        if (i < count)
+        {
+            destination[length++] = CSV_QUOTE;
+            i += 2;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Construct a new parser over the records of a text separated by a given delimetre.
+ * @param text Text to parse. The text is not copied, so it must outlive the parser and every field obtained from it.
+ * @param delimetre Charactor which separates the fields of a record, such as `,` or `\t`.
+ * @returns A new parser.
+ */
+csv_t csv_new(string_t text, char delimetre)
+{
+    csv_t csv;
+    memset(&csv, 0, sizeof(csv));
+    csv.rest = text;
+    csv.delimetre = delimetre;
+    csv.in_record = false;
+    csv.window = text.data;
+    csv.window_size = 0;
+    return csv;
+}
+
+/**
+ * @brief Advance the parser to the next record. The fields of the current record which have not been obtained are skipped, and any of its unescaped fields are invalidated.
+ * @param csv A pointer to the parser.
+ * @returns True if there is another record, else false once the text has been parsed.
+ */
+bool csv_next_record(csv_t *csv)
+{
+    string_t field;
+    while (csv_next_field(csv, &field))
+    {
+        continue;
+    }
+    _csv_release(csv);
+    if (csv->rest.count == 0)
+    {
+        return false;
+    }
+    csv->in_record = true;
+    return true;
+}
+
+/**
+ * @brief Obtain the next field of the current record. A field within quotes may contain the delimetre, line feeds, and quotes escaped by doubling them, and its quotes are removed. A carriage return before a line feed is left out of the last field, so both `\n` and `\r\n` endings are handled.
+ * @param csv A pointer to the parser.
+ * @param field A pointer to which to write the field. The field remains valid until the next record is started.
+ * @returns True if a field was written, else false once every field of the record has been obtained.
+ * @exception If a field must be unescaped and a block can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+bool csv_next_field(csv_t *csv, string_t *field)
+{
+    if (!csv->in_record)
+    {
+        return false;
+    }
+    const char *data = csv->rest.data;
+    const size_t count = csv->rest.count;
+    // Charactors after the closing quote, up to the delimetre, are kept as they are, like the charactors of an unquoted field.
+    size_t start = 0;
+    size_t close = 0;
+    bool escaped = false;
+    if (count > 0 && data[0] == CSV_QUOTE)
+    {
+        close = _csv_find_closing_quote(csv, &escaped);
+        start = close < count ? close + 1 : count;
+    }
+    const size_t end = (size_t) (_csv_find(csv, data + start, false) - data);
+    size_t stop = end;
+    if ((end == count || data[end] == '\n') && stop > start && data[stop - 1] == '\r')
+    {
+        stop--;
+    }
+    if (count == 0 || data[0] != CSV_QUOTE)
+    {
+        *field = string_new(data, stop);
+    }
+    else if (!escaped && stop == start)
+    {
+        *field = string_new(data + 1, close - 1);
+    }
+    else
+    {
+        char *destination = _csv_reserve(csv, close - 1 + stop - start);
+        size_t length = _csv_unescape(destination, data + 1, close - 1);
+        memcpy(destination + length, data + start, stop - start);
+        length += stop - start;
+        *field = string_new(destination, length);
+    }
+    if (end == count)
+    {
+        csv->in_record = false;
+        csv->rest = string_new(data + count, 0);
+    }
+    else
+    {
+        csv->in_record = data[end] == csv->delimetre;
+        csv->rest = string_new(data + end + 1, count - end - 1);
+    }
+    return true;
+}
+
+/**
+ * @brief Deallocate the blocks of the parser, which invalidates every unescaped field.
+ * @param csv A pointer to the parser to deallocate.
+ */
+void csv_delete(csv_t *csv)
+{
+    for (size_t i = 0; i < csv->block_count; ++i)
+    {
+        free(csv->blocks[i]);
+    }
+    free(csv->blocks);
+    csv->blocks = NULL;
+    csv->block_count = 0;
+    csv->block_capacity = 0;
+    csv->block_used = 0;
+    csv->block_size = 0;
+    csv->in_record = false;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // CSV_IMPLEMENTATION
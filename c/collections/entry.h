@@ -9,7 +9,7 @@ extern "C" {
 #include "../path.h" // path_t, passtr, path_exists, path_delete
 
 #define STRING_BUILDER_IMPLEMENTATION
-#include "string_builder.h" // string_builder_t, sring_builder_init, string_builder_append, string_builder_empty, string_builder_data, string_builder_delete
+#include "string_builder.h" // string_builder_t, sring_builder_init, string_builder_append, string_builder_reserve, string_builder_empty, string_builder_data, string_builder_delete
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -261,11 +261,18 @@ void _read_file(const path_t *path, string_builder_t *result)
         string_builder_delete(result);
         exit(1);
     };
-    while (!feof(file) && !ferror(file))
+    // The builder is grown once to the size of the file, and one more charactor, so that the end of the file is found without growing it again.
+    size_t size = 0;
+    if (_get_file_size(file, &size))
     {
-        int read = fgetc(file);
-        if (EOF == read) break;
-        string_builder_append(result, read);
+        string_builder_reserve(result, size + 1);
+    }
+    while (!ferror(file))
+    {
+        string_builder_reserve(result, 1);
+        const size_t read = fread(result->items + result->size, sizeof(char), result->capacity - result->size, file);
+        if (read == 0) break;
+        result->size += read;
     }
     fclose(file);
     string_builder_fit(result);
@@ -0,0 +1,485 @@
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h> // size_t
+#include <stdbool.h> // bool
+#include <stdint.h> // uint64_t
+
+#define STRING_VIEW_IMPLEMENTATION
+#include "./string_view.h"
+
+/**
+ * @brief A slot of the hash table. A hash of zero marks the slot as empty, so no key is ever given that hash.
+ */
+typedef struct
+{
+    uint64_t hash;
+    string_t key;
+    void *value;
+} hash_table_entry_t;
+
+/**
+ * @brief A hash table which maps strings to values with open addressing and linear probing. The keys are copied into blocks owned by the table, which are never moved, so a key within an entry remains valid for the lifetime of the table.
+ */
+typedef struct
+{
+    hash_table_entry_t *entries;
+    size_t size;
+    size_t capacity;
+    uint64_t seed;
+    char **blocks;
+    size_t block_count;
+    size_t block_capacity;
+    size_t block_used;
+    size_t block_size;
+} hash_table_t;
+
+/**
+ * @brief Construct a new hash table.
+ * @returns A new hash table.
+ * @exception If the entries can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+hash_table_t hash_table_init(void);
+
+/**
+ * @brief Construct a new hash table with room for a given number of keys.
+ * @param count Number of keys which can be inserted before the table is resized.
+ * @returns A new hash table with room for `count` keys.
+ * @exception If the entries can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+hash_table_t hash_table_with_capacity(size_t count);
+
+/**
+ * @brief Insert a key into the table with a given value, or replace the value of the key if it is already present. The key is copied into the table.
+ * @param table Table into which to insert.
+ * @param key Key to insert.
+ * @param value Value to associate with the key.
+ * @returns True if the key was not present before, else false.
+ * @exception If the table or its keys can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+bool hash_table_insert(hash_table_t *table, string_t key, void *value);
+
+/**
+ * @brief Find the entry of a given key.
+ * @param table Table in which to search.
+ * @param key Key to find.
+ * @returns A pointer to the entry of the key, or `NULL` if the key is not present. The pointer is invalidated by any insertion or removal.
+ */
+hash_table_entry_t *hash_table_find(const hash_table_t *table, string_t key);
+
+/**
+ * @brief Obtain the value of a given key.
+ * @param table Table in which to search.
+ * @param key Key of the value.
+ * @returns The value of the key, or `NULL` if the key is not present.
+ */
+void *hash_table_get(const hash_table_t *table, string_t key);
+
+/**
+ * @brief Determine whether a given key is present within the table.
+ * @param table Table in which to search.
+ * @param key Key to find.
+ * @returns True if the key is present, else false.
+ */
+bool hash_table_contains(const hash_table_t *table, string_t key);
+
+/**
+ * @brief Remove a given key from the table. The following entries of its run are shifted back, so no tombstones are left behind; the bytes of the key are only reclaimed when the table is deleted.
+ * @param table Table from which to remove.
+ * @param key Key to remove.
+ * @returns True if the key was present, else false.
+ */
+bool hash_table_remove(hash_table_t *table, string_t key);
+
+/**
+ * @brief Obtain the next entry of the table, for iterating over every entry in no particular order.
+ * @param table Table over which to iterate.
+ * @param cursor Position of the iteration, which must start at zero.
+ * @returns A pointer to the next entry, or `NULL` once every entry has been visited.
+ */
+hash_table_entry_t *hash_table_next(const hash_table_t *table, size_t *cursor);
+
+/**
+ * @brief Grow the table so that a given number of keys can be held without it being resized.
+ * @param table Table to grow.
+ * @param count Number of keys the table should hold.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void hash_table_reserve(hash_table_t *table, size_t count);
+
+/**
+ * @brief Resize the table by a factor of two.
+ * @param table Table to resize.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void hash_table_resize(hash_table_t *table);
+
+/**
+ * @brief Deallocate the table along with its keys.
+ * @param table Table to deallocate.
+ */
+void hash_table_delete(hash_table_t *table);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // HASH_TABLE_H
+
+#if defined(HASH_TABLE_IMPLEMENTATION) && !defined(HASH_TABLE_IMPLEMENTED)
+#define HASH_TABLE_IMPLEMENTED
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdlib.h> // NULL, exit, malloc, calloc, realloc, free
+#include <stdio.h> // fprintf, stderr
+#include <string.h> // memcpy, memcmp, memset
+
+#ifndef HASH_TABLE_CAPACITY
+#define HASH_TABLE_CAPACITY 16
+#endif // HASH_TABLE_CAPACITY
+
+#ifndef HASH_TABLE_BLOCK_SIZE
+#define HASH_TABLE_BLOCK_SIZE (64*1024)
+#endif // HASH_TABLE_BLOCK_SIZE
+
+#ifndef HASH_TABLE_SEED
+#define HASH_TABLE_SEED 0x9e3779b97f4a7c15u
+#endif // HASH_TABLE_SEED
+
+/**
+ * @brief Determine whether a table of a given capacity can hold a given number of keys, which keeps at least a quarter of the slots empty so that runs stay short.
+ * @param count Number of keys.
+ * @param capacity Number of slots.
+ * @returns True if the keys fit, else false.
+ */
+static bool _hash_table_fits(size_t count, size_t capacity)
+{
+    return count <= capacity - capacity / 4;
+}
+
+/**
+ * @brief Hash a key for the table. A hash of zero marks an empty slot, so it is replaced.
+ * @param table Table for which to hash.
+ * @param key Key to hash.
+ * @returns The non-zero hash of the key.
+ */
+static uint64_t _hash_table_hash(const hash_table_t *table, string_t key)
+{
+    const uint64_t hash = string_hash(key, table->seed);
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief Find the slot of a given key, or the empty slot at which the key would be inserted.
+ * @param table Table in which to search.
+ * @param key Key to find.
+ * @param hash Hash of the key.
+ * @returns The index of the slot.
+ */
+static size_t _hash_table_probe(const hash_table_t *table, string_t key, uint64_t hash)
+{
+    const size_t mask = table->capacity - 1;
+    size_t index = (size_t)hash & mask;
+    for (;;)
+    {
+        const hash_table_entry_t *entry = &table->entries[index];
+        if (entry->hash == 0)
+        {
+            return index;
+        }
+        // The full hash is compared first, so keys are only compared when they almost certainly match.
+        if (entry->hash == hash && entry->key.count == key.count && (key.count == 0 || memcmp(entry->key.data, key.data, key.count) == 0))
+        {
+            return index;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+/**
+ * @brief Reallocate the slots of the table to a given capacity, reinserting every entry by its stored hash.
+ * @param table Table to reallocate.
+ * @param capacity New number of slots, which must be a power of two that fits every entry.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static void _hash_table_rehash(hash_table_t *table, size_t capacity)
+{
+    hash_table_entry_t *entries = (hash_table_entry_t *)calloc(capacity, sizeof(hash_table_entry_t));
+    if (NULL == entries)
+    {
+        fprintf(stderr, "AllocationError: Can not reallocate the hash table.\n");
+        exit(1);
+    }
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        if (table->entries[i].hash == 0)
+        {
+            continue;
+        }
+        size_t index = (size_t)table->entries[i].hash & mask;
+        while (entries[index].hash != 0)
+        {
+            index = (index + 1) & mask;
+        }
+        entries[index] = table->entries[i];
+    }
+    free(table->entries);
+    table->entries = entries;
+    table->capacity = capacity;
+}
+
+/**
+ * @brief Copy a key into the blocks of the table. A new block is started when the key does not fit within the current one, so the copies of earlier keys never move.
+ * @param table Table into which to copy.
+ * @param key Key to copy.
+ * @returns A string of the copied key.
+ * @exception If a block can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static string_t _hash_table_store(hash_table_t *table, string_t key)
+{
+    if (key.count == 0)
+    {
+        return string_new("", 0);
+    }
+    if (table->block_count == 0 || table->block_size - table->block_used < key.count)
+    {
+        if (table->block_count >= table->block_capacity)
+        {
+            const size_t capacity = table->block_capacity ? table->block_capacity * 2 : 8;
+            char **blocks = (char **)realloc(table->blocks, capacity * sizeof(char *));
+            if (NULL == blocks)
+            {
+                fprintf(stderr, "AllocationError: Can not reallocate the blocks of the hash table.\n");
+                exit(1);
+            }
+            table->blocks = blocks;
+            table->block_capacity = capacity;
+        }
+        const size_t size = key.count > HASH_TABLE_BLOCK_SIZE ? key.count : HASH_TABLE_BLOCK_SIZE;
+        char *block = (char *)malloc(size);
+        if (NULL == block)
+        {
+            fprintf(stderr, "AllocationError: Can not allocate a block for the keys of the hash table.\n");
+            exit(1);
+        }
+        table->blocks[table->block_count++] = block;
+        table->block_used = 0;
+        table->block_size = size;
+    }
+    char *data = table->blocks[table->block_count - 1] + table->block_used;
+    memcpy(data, key.data, key.count);
+    table->block_used += key.count;
+    return string_new(data, key.count);
+}
+
+/**
+ * @brief Construct a new hash table.
+ * @returns A new hash table.
+ * @exception If the entries can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+hash_table_t hash_table_init(void)
+{
+    return hash_table_with_capacity(HASH_TABLE_CAPACITY - HASH_TABLE_CAPACITY / 4);
+}
+
+/**
+ * @brief Construct a new hash table with room for a given number of keys.
+ * @param count Number of keys which can be inserted before the table is resized.
+ * @returns A new hash table with room for `count` keys.
+ * @exception If the entries can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+hash_table_t hash_table_with_capacity(size_t count)
+{
+    hash_table_t table;
+    memset(&table, 0, sizeof(table));
+    table.seed = HASH_TABLE_SEED;
+    hash_table_reserve(&table, count);
+    return table;
+}
+
+/**
+ * @brief Insert a key into the table with a given value, or replace the value of the key if it is already present. The key is copied into the table.
+ * @param table Table into which to insert.
+ * @param key Key to insert.
+ * @param value Value to associate with the key.
+ * @returns True if the key was not present before, else false.
+ * @exception If the table or its keys can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+bool hash_table_insert(hash_table_t *table, string_t key, void *value)
+{
+    const uint64_t hash = _hash_table_hash(table, key);
+    // The key is looked up before the table grows, so replacing the value of a present key never rehashes.
+    size_t index = 0;
+    if (table->capacity > 0)
+    {
+        index = _hash_table_probe(table, key, hash);
+        if (table->entries[index].hash != 0)
+        {
+            table->entries[index].value = value;
+            return false;
+        }
+    }
+    if (!_hash_table_fits(table->size + 1, table->capacity))
+    {
+        hash_table_resize(table);
+        index = _hash_table_probe(table, key, hash);
+    }
+    hash_table_entry_t *entry = &table->entries[index];
+    entry->hash = hash;
+    entry->key = _hash_table_store(table, key);
+    entry->value = value;
+    table->size++;
+    return true;
+}
+
+/**
+ * @brief Find the entry of a given key.
+ * @param table Table in which to search.
+ * @param key Key to find.
+ * @returns A pointer to the entry of the key, or `NULL` if the key is not present. The pointer is invalidated by any insertion or removal.
+ */
+hash_table_entry_t *hash_table_find(const hash_table_t *table, string_t key)
+{
+    if (table->size == 0)
+    {
+        return NULL;
+    }
+    hash_table_entry_t *entry = &table->entries[_hash_table_probe(table, key, _hash_table_hash(table, key))];
+    return entry->hash != 0 ? entry : NULL;
+}
+
+/**
+ * @brief Obtain the value of a given key.
+ * @param table Table in which to search.
+ * @param key Key of the value.
+ * @returns The value of the key, or `NULL` if the key is not present.
+ */
+void *hash_table_get(const hash_table_t *table, string_t key)
+{
+    const hash_table_entry_t *entry = hash_table_find(table, key);
+    return entry ? entry->value : NULL;
+}
+
+/**
+ * @brief Determine whether a given key is present within the table.
+ * @param table Table in which to search.
+ * @param key Key to find.
+ * @returns True if the key is present, else false.
+ */
+bool hash_table_contains(const hash_table_t *table, string_t key)
+{
+    return hash_table_find(table, key) != NULL;
+}
+
+/**
+ * @brief Remove a given key from the table. The following entries of its run are shifted back, so no tombstones are left behind; the bytes of the key are only reclaimed when the table is deleted.
+ * @param table Table from which to remove.
+ * @param key Key to remove.
+ * @returns True if the key was present, else false.
+ */
+bool hash_table_remove(hash_table_t *table, string_t key)
+{
+    hash_table_entry_t *entry = hash_table_find(table, key);
+    if (NULL == entry)
+    {
+        return false;
+    }
+    const size_t mask = table->capacity - 1;
+    size_t hole = (size_t)(entry - table->entries);
+    size_t index = hole;
+    for (;;)
+    {
+        index = (index + 1) & mask;
+        hash_table_entry_t *next = &table->entries[index];
+        if (next->hash == 0)
+        {
+            break;
+        }
+        // An entry may fill the hole only if its home slot does not lie after the hole, wrapping around, in its run.
+        const size_t home = (size_t)next->hash & mask;
+        if (((index - home) & mask) >= ((index - hole) & mask))
+        {
+            table->entries[hole] = *next;
+            hole = index;
+        }
+    }
+    table->entries[hole].hash = 0;
+    table->size--;
+    return true;
+}
+
+/**
+ * @brief Obtain the next entry of the table, for iterating over every entry in no particular order.
+ * @param table Table over which to iterate.
+ * @param cursor Position of the iteration, which must start at zero.
+ * @returns A pointer to the next entry, or `NULL` once every entry has been visited.
+ */
+hash_table_entry_t *hash_table_next(const hash_table_t *table, size_t *cursor)
+{
+    for (; *cursor < table->capacity; ++*cursor)
+    {
+        if (table->entries[*cursor].hash != 0)
+        {
+            return &table->entries[(*cursor)++];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Grow the table so that a given number of keys can be held without it being resized.
+ * @param table Table to grow.
+ * @param count Number of keys the table should hold.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void hash_table_reserve(hash_table_t *table, size_t count)
+{
+    size_t capacity = table->capacity ? table->capacity : 8;
+    while (!_hash_table_fits(count, capacity))
+    {
+        capacity *= 2;
+    }
+    if (capacity != table->capacity)
+    {
+        _hash_table_rehash(table, capacity);
+    }
+}
+
+/**
+ * @brief Resize the table by a factor of two.
+ * @param table Table to resize.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void hash_table_resize(hash_table_t *table)
+{
+    _hash_table_rehash(table, table->capacity ? table->capacity * 2 : HASH_TABLE_CAPACITY);
+}
+
+/**
+ * @brief Deallocate the table along with its keys.
+ * @param table Table to deallocate.
+ */
+void hash_table_delete(hash_table_t *table)
+{
+    for (size_t i = 0; i < table->block_count; ++i)
+    {
+        free(table->blocks[i]);
+    }
+    free(table->blocks);
+    free(table->entries);
+    memset(table, 0, sizeof(*table));
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // HASH_TABLE_IMPLEMENTATION
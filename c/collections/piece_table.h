@@ -0,0 +1,576 @@
+#ifndef PIECE_TABLE_H
+#define PIECE_TABLE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h> // size_t
+#include <stdbool.h> // bool
+#include <stdint.h> // uint32_t, SIZE_MAX
+
+#include "./string_builder.h"
+
+/**
+ * @brief Index of a piece that does not exist.
+ */
+#define PIECE_TABLE_NULL SIZE_MAX
+
+/**
+ * @brief A contiguous run of text within either the original or the added buffer. Pieces are the nodes of an implicit treap ordered by their position within the text.
+ */
+typedef struct
+{
+    bool added;
+    size_t start;
+    size_t length;
+    size_t total;
+    uint32_t priority;
+    size_t left;
+    size_t right;
+} piece_t;
+
+/**
+ * @brief A text buffer that records edits as pieces rather than moving the text. The original text is never copied or modified; inserted text is appended to a separate buffer. Inserting and removing at any offset takes logarithmic time in the number of pieces.
+ */
+typedef struct
+{
+    string_t original;
+    string_builder_t added;
+    piece_t *pieces;
+    size_t count;
+    size_t capacity;
+    size_t root;
+    size_t free;
+    uint32_t seed;
+} piece_table_t;
+
+/**
+ * @brief Construct a new piece table over a given text. The text is not copied, so it must outlive the table.
+ * @param original Text from which to start.
+ * @returns A new piece table.
+ * @exception If the table can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+piece_table_t piece_table_init(string_t original);
+
+/**
+ * @brief Insert text at a given offset.
+ * @param table Table into which to insert.
+ * @param offset Offset at which to insert the text.
+ * @param text Text to insert. The text is copied into the table, and may be a slice of the table itself.
+ * @exception If the given offset is greater than the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_insert(piece_table_t *table, size_t offset, string_t text);
+
+/**
+ * @brief Remove a range of text at a given offset.
+ * @param table Table from which to remove.
+ * @param offset Offset of the first character to remove.
+ * @param count Number of characters to remove.
+ * @exception If the range extends past the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_remove(piece_table_t *table, size_t offset, size_t count);
+
+/**
+ * @brief Obtain the character at a given offset.
+ * @param table Table from which to access.
+ * @param offset Offset of the character.
+ * @returns The character at the given offset.
+ * @exception If the given offset is greater than or equal to the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ */
+char piece_table_at(const piece_table_t *table, size_t offset);
+
+/**
+ * @brief Obtain a view of the contiguous text that starts at a given offset and runs to the end of its piece. Successive slices are obtained by advancing the offset by the count of each slice.
+ * @param table Table from which to obtain the slice.
+ * @param offset Offset at which the slice starts.
+ * @returns A view into the table, or an empty string if the offset is the size of the table. The view is valid until the table is next modified.
+ * @exception If the given offset is greater than the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ */
+string_t piece_table_slice(const piece_table_t *table, size_t offset);
+
+/**
+ * @brief Call a given function for every slice of the table in order.
+ * @param table Table whose slices to visit.
+ * @param function Function to call with every slice and the given context.
+ * @param context Pointer passed through to the function.
+ */
+void piece_table_for_each(const piece_table_t *table, void (*function)(string_t slice, void *context), void *context);
+
+/**
+ * @brief Append the whole text of the table to a builder.
+ * @param table Table to flatten.
+ * @param builder Builder to which to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_flatten(const piece_table_t *table, string_builder_t *builder);
+
+/**
+ * @brief Obtain the number of characters within the table.
+ * @param table Table which is evaluated.
+ * @returns The size of the table.
+ */
+size_t piece_table_size(const piece_table_t *table);
+
+/**
+ * @brief Determine if the table is empty.
+ * @param table Table which is evaluated.
+ * @returns If the table is evaluated to be empty, `true` is returned, else `false`.
+ */
+bool piece_table_empty(const piece_table_t *table);
+
+/**
+ * @brief Deallocate the table. The original text is not deallocated.
+ * @param table Table which to deallocate.
+ */
+void piece_table_delete(piece_table_t *table);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // PIECE_TABLE_H
+
+#if defined(PIECE_TABLE_IMPLEMENTATION) && !defined(PIECE_TABLE_IMPLEMENTED)
+#define PIECE_TABLE_IMPLEMENTED
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdio.h> // fprintf, stderr
+#include <stdlib.h> // malloc, realloc, free, exit, NULL
+
+#define STRING_BUILDER_IMPLEMENTATION
+#include "./string_builder.h"
+
+#ifndef PIECE_TABLE_INITIAL_CAPACITY
+#define PIECE_TABLE_INITIAL_CAPACITY 64
+#endif // PIECE_TABLE_INITIAL_CAPACITY
+
+/**
+ * @brief Obtain the number of characters within a subtree of pieces.
+ * @param table Table that owns the pieces.
+ * @param piece Root of the subtree.
+ * @returns The number of characters within the subtree, or zero if the subtree is empty.
+ */
+static size_t piece_table_total(const piece_table_t *table, size_t piece)
+{
+    return PIECE_TABLE_NULL == piece ? 0 : table->pieces[piece].total;
+}
+
+/**
+ * @brief Recalculate the number of characters within a subtree after its children have changed.
+ * @param table Table that owns the pieces.
+ * @param piece Root of the subtree.
+ */
+static void piece_table_update(piece_table_t *table, size_t piece)
+{
+    piece_t *node = &table->pieces[piece];
+    node->total = piece_table_total(table, node->left) + node->length + piece_table_total(table, node->right);
+}
+
+/**
+ * @brief Allocate a new piece, reusing a freed piece where possible.
+ * @param table Table that owns the pieces.
+ * @param added Whether the piece refers to the added buffer rather than the original text.
+ * @param start Offset of the piece within its buffer.
+ * @param length Number of characters within the piece.
+ * @param priority Heap priority of the piece.
+ * @returns The index of the new piece. Any pointer into the pieces is invalidated.
+ * @exception If the pieces can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static size_t piece_table_piece_new(piece_table_t *table, bool added, size_t start, size_t length, uint32_t priority)
+{
+    size_t piece = table->free;
+    if (PIECE_TABLE_NULL != piece)
+    {
+        table->free = table->pieces[piece].left;
+    }
+    else
+    {
+        if (table->count >= table->capacity)
+        {
+            piece_t *pieces = (piece_t *)realloc(table->pieces, table->capacity * 2 * sizeof(piece_t));
+            if (NULL == pieces)
+            {
+                fprintf(stderr, "AllocationError: Can not reallocate the pieces of the table.\n");
+                piece_table_delete(table);
+                exit(1);
+            }
+            table->pieces = pieces;
+            table->capacity *= 2;
+        }
+        piece = table->count++;
+    }
+    table->pieces[piece] = (piece_t)
+    {
+        .added = added,
+        .start = start,
+        .length = length,
+        .total = length,
+        .priority = priority,
+        .left = PIECE_TABLE_NULL,
+        .right = PIECE_TABLE_NULL,
+    };
+    return piece;
+}
+
+/**
+ * @brief Return every piece within a subtree to the free list.
+ * @param table Table that owns the pieces.
+ * @param piece Root of the subtree.
+ */
+static void piece_table_piece_free(piece_table_t *table, size_t piece)
+{
+    while (PIECE_TABLE_NULL != piece)
+    {
+        piece_table_piece_free(table, table->pieces[piece].left);
+        size_t right = table->pieces[piece].right;
+        table->pieces[piece].left = table->free;
+        table->free = piece;
+        piece = right;
+    }
+}
+
+/**
+ * @brief Draw a pseudo-random heap priority with xorshift.
+ * @param table Table whose seed to advance.
+ * @returns A new priority.
+ */
+static uint32_t piece_table_priority(piece_table_t *table)
+{
+    uint32_t x = table->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    table->seed = x;
+    return x;
+}
+
+/**
+ * @brief Split a subtree into the pieces before a given offset and the pieces from it onwards. A piece that straddles the offset is cut in two.
+ * @param table Table that owns the pieces.
+ * @param piece Root of the subtree.
+ * @param offset Offset within the subtree at which to split.
+ * @param left Set to the root of the subtree holding the first `offset` characters.
+ * @param right Set to the root of the subtree holding the remaining characters.
+ */
+static void piece_table_split(piece_table_t *table, size_t piece, size_t offset, size_t *left, size_t *right)
+{
+    if (PIECE_TABLE_NULL == piece)
+    {
+        *left = PIECE_TABLE_NULL;
+        *right = PIECE_TABLE_NULL;
+        return;
+    }
+    size_t before = piece_table_total(table, table->pieces[piece].left);
+    size_t length = table->pieces[piece].length;
+    size_t child;
+    if (offset <= before)
+    {
+        piece_table_split(table, table->pieces[piece].left, offset, left, &child);
+        table->pieces[piece].left = child;
+        piece_table_update(table, piece);
+        *right = piece;
+    }
+    else if (offset >= before + length)
+    {
+        piece_table_split(table, table->pieces[piece].right, offset - before - length, &child, right);
+        table->pieces[piece].right = child;
+        piece_table_update(table, piece);
+        *left = piece;
+    }
+    else
+    {
+        // The cut piece inherits the priority of the original, so it may take over the original's right subtree.
+        size_t cut = offset - before;
+        size_t tail = piece_table_piece_new(table, table->pieces[piece].added, table->pieces[piece].start + cut, length - cut, table->pieces[piece].priority);
+        table->pieces[tail].right = table->pieces[piece].right;
+        piece_table_update(table, tail);
+        table->pieces[piece].length = cut;
+        table->pieces[piece].right = PIECE_TABLE_NULL;
+        piece_table_update(table, piece);
+        *left = piece;
+        *right = tail;
+    }
+}
+
+/**
+ * @brief Join two subtrees, every character of the first preceding every character of the second.
+ * @param table Table that owns the pieces.
+ * @param left Root of the first subtree.
+ * @param right Root of the second subtree.
+ * @returns The root of the joined subtree.
+ */
+static size_t piece_table_merge(piece_table_t *table, size_t left, size_t right)
+{
+    if (PIECE_TABLE_NULL == left)
+    {
+        return right;
+    }
+    if (PIECE_TABLE_NULL == right)
+    {
+        return left;
+    }
+    if (table->pieces[left].priority > table->pieces[right].priority)
+    {
+        table->pieces[left].right = piece_table_merge(table, table->pieces[left].right, right);
+        piece_table_update(table, left);
+        return left;
+    }
+    table->pieces[right].left = piece_table_merge(table, left, table->pieces[right].left);
+    piece_table_update(table, right);
+    return right;
+}
+
+/**
+ * @brief Obtain the buffer to which a piece refers.
+ * @param table Table that owns the pieces.
+ * @param piece Piece whose buffer to obtain.
+ * @returns A pointer to the first character of the piece.
+ */
+static const char *piece_table_piece_data(const piece_table_t *table, const piece_t *piece)
+{
+    return (piece->added ? table->added.items : table->original.data) + piece->start;
+}
+
+/**
+ * @brief Call a given function for every slice of a subtree in order.
+ * @param table Table that owns the pieces.
+ * @param piece Root of the subtree.
+ * @param function Function to call with every slice and the given context.
+ * @param context Pointer passed through to the function.
+ */
+static void piece_table_visit(const piece_table_t *table, size_t piece, void (*function)(string_t slice, void *context), void *context)
+{
+    while (PIECE_TABLE_NULL != piece)
+    {
+        const piece_t *node = &table->pieces[piece];
+        piece_table_visit(table, node->left, function, context);
+        function(string_new(piece_table_piece_data(table, node), node->length), context);
+        piece = node->right;
+    }
+}
+
+/**
+ * @brief Append a slice to a builder.
+ * @param slice Slice to append.
+ * @param context The builder to which to append.
+ */
+static void piece_table_flatten_slice(string_t slice, void *context)
+{
+    string_builder_append_view((string_builder_t *)context, slice);
+}
+
+/**
+ * @brief Construct a new piece table over a given text. The text is not copied, so it must outlive the table.
+ * @param original Text from which to start.
+ * @returns A new piece table.
+ * @exception If the table can not be allocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+piece_table_t piece_table_init(string_t original)
+{
+    piece_t *pieces = (piece_t *)malloc(PIECE_TABLE_INITIAL_CAPACITY * sizeof(piece_t));
+    if (NULL == pieces)
+    {
+        fprintf(stderr, "AllocationError: Can not allocate enough memory for the pieces of the table.\n");
+        exit(1);
+    }
+    piece_table_t table = (piece_table_t)
+    {
+        .original = original,
+        .added = string_builder_init(),
+        .pieces = pieces,
+        .count = 0,
+        .capacity = PIECE_TABLE_INITIAL_CAPACITY,
+        .root = PIECE_TABLE_NULL,
+        .free = PIECE_TABLE_NULL,
+        .seed = 2463534242u,
+    };
+    if (original.count > 0)
+    {
+        table.root = piece_table_piece_new(&table, false, 0, original.count, piece_table_priority(&table));
+    }
+    return table;
+}
+
+/**
+ * @brief Insert text at a given offset.
+ * @param table Table into which to insert.
+ * @param offset Offset at which to insert the text.
+ * @param text Text to insert. The text is copied into the table, and may be a slice of the table itself.
+ * @exception If the given offset is greater than the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_insert(piece_table_t *table, size_t offset, string_t text)
+{
+    if (offset > piece_table_size(table))
+    {
+        fprintf(stderr, "IndexError: Can not insert into a table of size %zu at offset %zu.\n", piece_table_size(table), offset);
+        piece_table_delete(table);
+        exit(1);
+    }
+    if (0 == text.count)
+    {
+        return;
+    }
+    // The text may be a slice of this table, so it is appended at once by a function that allows it to alias the buffer.
+    size_t start = table->added.size;
+    string_builder_append_view(&table->added, text);
+    size_t left, right;
+    piece_table_split(table, table->root, offset, &left, &right);
+    size_t piece = piece_table_piece_new(table, true, start, text.count, piece_table_priority(table));
+    table->root = piece_table_merge(table, piece_table_merge(table, left, piece), right);
+}
+
+/**
+ * @brief Remove a range of text at a given offset.
+ * @param table Table from which to remove.
+ * @param offset Offset of the first character to remove.
+ * @param count Number of characters to remove.
+ * @exception If the range extends past the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ * @exception If the table can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_remove(piece_table_t *table, size_t offset, size_t count)
+{
+    size_t size = piece_table_size(table);
+    if (offset > size || count > size - offset)
+    {
+        fprintf(stderr, "IndexError: Can not remove %zu characters from a table of size %zu at offset %zu.\n", count, size, offset);
+        piece_table_delete(table);
+        exit(1);
+    }
+    if (0 == count)
+    {
+        return;
+    }
+    size_t left, middle, right;
+    piece_table_split(table, table->root, offset, &left, &right);
+    piece_table_split(table, right, count, &middle, &right);
+    piece_table_piece_free(table, middle);
+    table->root = piece_table_merge(table, left, right);
+}
+
+/**
+ * @brief Obtain the character at a given offset.
+ * @param table Table from which to access.
+ * @param offset Offset of the character.
+ * @returns The character at the given offset.
+ * @exception If the given offset is greater than or equal to the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ */
+char piece_table_at(const piece_table_t *table, size_t offset)
+{
+    if (offset >= piece_table_size(table))
+    {
+        fprintf(stderr, "IndexError: Can not access a table of size %zu at offset %zu.\n", piece_table_size(table), offset);
+        exit(1);
+    }
+    return piece_table_slice(table, offset).data[0];
+}
+
+/**
+ * @brief Obtain a view of the contiguous text that starts at a given offset and runs to the end of its piece. Successive slices are obtained by advancing the offset by the count of each slice.
+ * @param table Table from which to obtain the slice.
+ * @param offset Offset at which the slice starts.
+ * @returns A view into the table, or an empty string if the offset is the size of the table. The view is valid until the table is next modified.
+ * @exception If the given offset is greater than the size of the table, an `IndexError` is printed to `stderr` and the programme exits.
+ */
+string_t piece_table_slice(const piece_table_t *table, size_t offset)
+{
+    if (offset > piece_table_size(table))
+    {
+        fprintf(stderr, "IndexError: Can not slice a table of size %zu at offset %zu.\n", piece_table_size(table), offset);
+        exit(1);
+    }
+    size_t piece = table->root;
+    while (PIECE_TABLE_NULL != piece)
+    {
+        const piece_t *node = &table->pieces[piece];
+        size_t before = piece_table_total(table, node->left);
+        if (offset < before)
+        {
+            piece = node->left;
+        }
+        else if (offset < before + node->length)
+        {
+            size_t within = offset - before;
+            return string_new(piece_table_piece_data(table, node) + within, node->length - within);
+        }
+        else
+        {
+            offset -= before + node->length;
+            piece = node->right;
+        }
+    }
+    return string_new(NULL, 0);
+}
+
+/**
+ * @brief Call a given function for every slice of the table in order.
+ * @param table Table whose slices to visit.
+ * @param function Function to call with every slice and the given context.
+ * @param context Pointer passed through to the function.
+ */
+void piece_table_for_each(const piece_table_t *table, void (*function)(string_t slice, void *context), void *context)
+{
+    piece_table_visit(table, table->root, function, context);
+}
+
+/**
+ * @brief Append the whole text of the table to a builder.
+ * @param table Table to flatten.
+ * @param builder Builder to which to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void piece_table_flatten(const piece_table_t *table, string_builder_t *builder)
+{
+    piece_table_visit(table, table->root, piece_table_flatten_slice, builder);
+}
+
+/**
+ * @brief Obtain the number of characters within the table.
+ * @param table Table which is evaluated.
+ * @returns The size of the table.
+ */
+size_t piece_table_size(const piece_table_t *table)
+{
+    return piece_table_total(table, table->root);
+}
+
+/**
+ * @brief Determine if the table is empty.
+ * @param table Table which is evaluated.
+ * @returns If the table is evaluated to be empty, `true` is returned, else `false`.
+ */
+bool piece_table_empty(const piece_table_t *table)
+{
+    return piece_table_size(table) == 0;
+}
+
+/**
+ * @brief Deallocate the table. The original text is not deallocated.
+ * @param table Table which to deallocate.
+ */
+void piece_table_delete(piece_table_t *table)
+{
+    string_builder_delete(&table->added);
+    if (NULL == table->pieces)
+    {
+        return;
+    }
+    free(table->pieces);
+    table->pieces = NULL;
+    table->count = 0;
+    table->capacity = 0;
+    table->root = PIECE_TABLE_NULL;
+    table->free = PIECE_TABLE_NULL;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // PIECE_TABLE_IMPLEMENTATION
@@ -36,6 +36,15 @@ string_builder_t string_builder_init(void);
  */
 string_builder_t string_builder_with_capacity(size_t capacity);
 
+/**
+ * @brief Grow the buffer by factors of two until a given number of characters can be appended, reallocating it at most once.
+ * @param builder Buffer to grow.
+ * @param count Number of characters to make room for.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_reserve(string_builder_t *builder, size_t count);
+
 /**
  * @brief Append a character to the buffer of characters. If the buffer is full, the buffer is resized by an exponential factor of two.
  * @param builder Buffer of characters to which to append.
@@ -53,6 +62,75 @@ void string_builder_append(string_builder_t *builder, char item);
  */
 void string_builder_extend(string_builder_t *builder, const char *items);
 
+/**
+ * @brief Append a range of characters to the buffer at once. The buffer grows at most once, and the characters are copied with a single `memcpy`. The characters may be within the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param items Pointer to the first character to append.
+ * @param count Number of characters to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_n(string_builder_t *builder, const char *items, size_t count);
+
+/**
+ * @brief Append a string to the buffer of characters at once. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_view(string_builder_t *builder, string_t string);
+
+/**
+ * @brief Append strings to the buffer of characters with a separator between each pair of them. The length of the result is computed first, so the buffer grows at most once.
+ * @param builder Buffer of characters to which to append.
+ * @param strings Pointer to the strings to join, none of which may be a view into the buffer itself.
+ * @param count Number of strings.
+ * @param separator String to append between each pair of strings.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_join(string_builder_t *builder, const string_t *strings, size_t count, string_t separator);
+
+/**
+ * @brief Append a string to the buffer of characters with its ASCII letters in lowercase. The buffer grows at most once, and the letters are folded many bytes at a time. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_lower(string_builder_t *builder, string_t string);
+
+/**
+ * @brief Append a string to the buffer of characters with its ASCII letters in uppercase. The buffer grows at most once, and the letters are folded many bytes at a time. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_upper(string_builder_t *builder, string_t string);
+
+/**
+ * @brief Append a code point to the buffer of characters encoded as UTF-8. A surrogate, or a value outside of the range of Unicode, is appended as the replacement charactor `U+FFFD`.
+ * @param builder Buffer of characters to which to append.
+ * @param code_point Code point to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_code_point(string_builder_t *builder, char_t code_point);
+
+/**
+ * @brief Append a string of UTF-8 to the buffer of characters, replacing every invalid sequence with the replacement charactor `U+FFFD`, so that the buffer only ever holds valid UTF-8. Valid input is validated many bytes at a time and copied at once. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String of UTF-8 from which to append to the buffer.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_utf8(string_builder_t *builder, string_t string);
+
+/**
+ * @brief Append a string of Latin-1 — ISO-8859-1 — to the buffer of characters transcoded to UTF-8. Every byte is a code point below `U+0100`, so each takes one or two bytes. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String of Latin-1 from which to append to the buffer.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_latin1(string_builder_t *builder, string_t string);
+
 /**
  * @brief Obtain a pointer to a character in the buffer at a given index.
  * @param builder Buffer from which to access.
@@ -90,10 +168,10 @@ const char *string_builder_data(string_builder_t *builder);
 void string_builder_fit(string_builder_t *builder);
 
 /**
- * @brief Fit the capacity of the builder to its size.
- * @param builder Builder to fit.
+ * @brief Append the characters of one buffer to another at once.
+ * @param destination Buffer to which to append.
+ * @param source Buffer from which to append. It may be the destination itself.
  * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
- * @exception If the given index is greater than the size of the builder, an `IndexError` is printed to `stderr` and the programme exits.
  */
 void string_builder_combine(string_builder_t *destination, const string_builder_t *source);
 
@@ -109,7 +187,6 @@ string_t sbtosv(const string_builder_t *builder);
  * @param builder Buffer from which to remove an element.
  * @param index Index at which the removeable element is located.
  * @exception If the given index is greater than the size of the buffer, an `IndexError` to `stderr` is printed and the programme exits.
- * @exception If the buffer can not be reallocated, an `AllocationError` is printed to `stderr` and the programme exits.
  * @exception If the buffer is evaluated to be empty, a `ValueError` is printed to `stderr` and the programme exits.
  */
 void string_builder_remove(string_builder_t *builder, size_t index);
@@ -148,14 +225,17 @@ void string_builder_delete(string_builder_t *builder);
 
 #endif // STRING_BUILDER_H
 
-#ifdef STRING_BUILDER_IMPLEMENTATION
+#if defined(STRING_BUILDER_IMPLEMENTATION) && !defined(STRING_BUILDER_IMPLEMENTED)
+#define STRING_BUILDER_IMPLEMENTED
 
 #if defined (__cplusplus)
 extern "C" {
 #endif
 
 #include <stdio.h> // fprintf, stderr
+#include <stdint.h> // SIZE_MAX
 #include <stdlib.h> // malloc, realloc, free, exit, NULL
+#include <string.h> // memmove, memcpy
 
 #ifndef STRING_BUILDER_INITIAL_CAPACITY
 #define STRING_BUILDER_INITIAL_CAPACITY 256
@@ -193,6 +273,64 @@ string_builder_t string_builder_with_capacity(size_t capacity)
     };
 }
 
+/**
+ * @brief Grow the buffer by factors of two until a given number of characters can be appended, reallocating it at most once.
+ * @param builder Buffer to grow.
+ * @param count Number of characters to make room for.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_reserve(string_builder_t *builder, size_t count)
+{
+    if (count > SIZE_MAX - builder->size)
+    {
+        fprintf(stderr, "AllocationError: Can not grow a buffer of size %zu by %zu characters.\n", builder->size, count);
+        string_builder_delete(builder);
+        exit(1);
+    }
+    const size_t required = builder->size + count;
+    if (required <= builder->capacity)
+    {
+        return;
+    }
+    size_t capacity = builder->capacity ? builder->capacity : STRING_BUILDER_INITIAL_CAPACITY;
+    while (capacity < required)
+    {
+        // Doubling past the largest size would wrap around, so the buffer grows to exactly what is required instead.
+        capacity = capacity > SIZE_MAX / 2 ? required : capacity * 2;
+    }
+    char *items = (char *)realloc(builder->items, capacity * sizeof(char));
+    if (NULL == items)
+    {
+        fprintf(stderr, "AllocationError: Can not reallocate the buffer.\n");
+        string_builder_delete(builder);
+        exit(1);
+    }
+    builder->items = items;
+    builder->capacity = capacity;
+}
+
+/**
+ * @brief Make room for a given number of characters to be appended from a string, which may be a view into the buffer itself. Growing the buffer moves it, so such a view is found again by its offset.
+ * @param builder Buffer to grow.
+ * @param string A pointer to the string to be appended, which is updated if it is a view into the buffer.
+ * @param count Number of characters to make room for.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static void _string_builder_reserve_for(string_builder_t *builder, string_t *string, size_t count)
+{
+    if (builder->items != NULL && string->data >= builder->items && string->data < builder->items + builder->size)
+    {
+        const size_t offset = (size_t) (string->data - builder->items);
+        string_builder_reserve(builder, count);
+        string->data = builder->items + offset;
+    }
+    else
+    {
+        string_builder_reserve(builder, count);
+    }
+}
+
 /**
  * @brief Append a character to the buffer of characters. If the buffer is full, the buffer is resized by an exponential factor of two.
  * @param builder Buffer of characters to which to append.
@@ -203,7 +341,7 @@ void string_builder_append(string_builder_t *builder, char item)
 {
     if (builder->size >= builder->capacity)
     {
-        string_builder_resize(builder);
+        string_builder_reserve(builder, 1);
     }
     builder->items[builder->size++] = item;
 }
@@ -222,11 +360,221 @@ void string_builder_extend(string_builder_t *builder, const char *items)
         fprintf(stderr, "IllegalParametreError: items can not be NULL.\n");
         exit(1);
     }
-    size_t length = strlen(items);
-    for (size_t i = 0; i < length; ++i)
+    string_builder_append_n(builder, items, strlen(items));
+}
+
+/**
+ * @brief Append a range of characters to the buffer at once. The buffer grows at most once, and the characters are copied with a single `memcpy`. The characters may be within the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param items Pointer to the first character to append.
+ * @param count Number of characters to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_n(string_builder_t *builder, const char *items, size_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    string_t string = string_new(items, count);
+    _string_builder_reserve_for(builder, &string, count);
+    memcpy(builder->items + builder->size, string.data, count);
+    builder->size += count;
+}
+
+/**
+ * @brief Append a string to the buffer of characters at once. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_view(string_builder_t *builder, string_t string)
+{
+    string_builder_append_n(builder, string.data, string.count);
+}
+
+/**
+ * @brief Append strings to the buffer of characters with a separator between each pair of them. The length of the result is computed first, so the buffer grows at most once.
+ * @param builder Buffer of characters to which to append.
+ * @param strings Pointer to the strings to join, none of which may be a view into the buffer itself.
+ * @param count Number of strings.
+ * @param separator String to append between each pair of strings.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_join(string_builder_t *builder, const string_t *strings, size_t count, string_t separator)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    size_t total = separator.count * (count - 1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        total += strings[i].count;
+    }
+    string_builder_reserve(builder, total);
+    char *destination = builder->items + builder->size;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i > 0 && separator.count > 0)
+        {
+            memcpy(destination, separator.data, separator.count);
+            destination += separator.count;
+        }
+        if (strings[i].count > 0)
+        {
+            memcpy(destination, strings[i].data, strings[i].count);
+            destination += strings[i].count;
+        }
+    }
+    builder->size += total;
+}
+
+/**
+ * @brief Append a string to the buffer of characters with its ASCII letters in lowercase. The buffer grows at most once, and the letters are folded many bytes at a time. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_lower(string_builder_t *builder, string_t string)
+{
+    _string_builder_reserve_for(builder, &string, string.count);
+    string_copy_lower(&string, builder->items + builder->size);
+    builder->size += string.count;
+}
+
+/**
+ * @brief Append a string to the buffer of characters with its ASCII letters in uppercase. The buffer grows at most once, and the letters are folded many bytes at a time. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String from which to append to the buffer.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_upper(string_builder_t *builder, string_t string)
+{
+    _string_builder_reserve_for(builder, &string, string.count);
+    string_copy_upper(&string, builder->items + builder->size);
+    builder->size += string.count;
+}
+
+/**
+ * @brief Append a code point to the buffer of characters encoded as UTF-8. A surrogate, or a value outside of the range of Unicode, is appended as the replacement charactor `U+FFFD`.
+ * @param builder Buffer of characters to which to append.
+ * @param code_point Code point to append.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_code_point(string_builder_t *builder, char_t code_point)
+{
+    if (code_point < 0 || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF))
+    {
+        code_point = 0xFFFD;
+    }
+    char bytes[4];
+    size_t length;
+    if (code_point < 0x80)
+    {
+        bytes[0] = (char) code_point;
+        length = 1;
+    }
+    else if (code_point < 0x800)
+    {
+        bytes[0] = (char) (0xC0 | (code_point >> 6));
+        bytes[1] = (char) (0x80 | (code_point & 0x3F));
+        length = 2;
+    }
+    else if (code_point < 0x10000)
+    {
+        bytes[0] = (char) (0xE0 | (code_point >> 12));
+        bytes[1] = (char) (0x80 | ((code_point >> 6) & 0x3F));
+        bytes[2] = (char) (0x80 | (code_point & 0x3F));
+        length = 3;
+    }
+    else
+    {
+        bytes[0] = (char) (0xF0 | (code_point >> 18));
+        bytes[1] = (char) (0x80 | ((code_point >> 12) & 0x3F));
+        bytes[2] = (char) (0x80 | ((code_point >> 6) & 0x3F));
+        bytes[3] = (char) (0x80 | (code_point & 0x3F));
+        length = 4;
+    }
+    string_builder_append_n(builder, bytes, length);
+}
+
+/**
+ * @brief Append a string of UTF-8 to the buffer of characters, replacing every invalid sequence with the replacement charactor `U+FFFD`, so that the buffer only ever holds valid UTF-8. Valid input is validated many bytes at a time and copied at once. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String of UTF-8 from which to append to the buffer.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_utf8(string_builder_t *builder, string_t string)
+{
+    if (string_is_valid_utf8(&string))
+    {
+        string_builder_append_n(builder, string.data, string.count);
+        return;
+    }
+    // Every byte takes at most the three bytes of a replacement charactor, so room for the worst case is made at once and the string, which may be a view into the buffer, never moves again.
+    if (string.count > SIZE_MAX / 3)
+    {
+        fprintf(stderr, "AllocationError: Can not transcode %zu characters of UTF-8 into the buffer.\n", string.count);
+        string_builder_delete(builder);
+        exit(1);
+    }
+    _string_builder_reserve_for(builder, &string, 3 * string.count);
+    // Runs of valid sequences are copied at once, and each invalid sequence is replaced.
+    size_t start = 0;
+    for (size_t i = 0; i < string.count;)
+    {
+        char_t code_point;
+        bool valid;
+        const size_t length = _string_utf8_decode(string.data + i, string.count - i, &code_point, &valid);
+        if (!valid)
+        {
+            string_builder_append_n(builder, string.data + start, i - start);
+            string_builder_append_code_point(builder, code_point);
+            start = i + length;
+        }
+        i += length;
+    }
+    string_builder_append_n(builder, string.data + start, string.count - start);
+}
+
+/**
+ * @brief Append a string of Latin-1 — ISO-8859-1 — to the buffer of characters transcoded to UTF-8. Every byte is a code point below `U+0100`, so each takes one or two bytes. The string may be a view into the buffer itself.
+ * @param builder Buffer of characters to which to append.
+ * @param string String of Latin-1 from which to append to the buffer.
+ * @exception If the size of the buffer would overflow, an `AllocationError` is printed to standard error and the programme exits.
+ * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
+ */
+void string_builder_append_latin1(string_builder_t *builder, string_t string)
+{
+    if (string_is_ascii(&string))
+    {
+        string_builder_append_n(builder, string.data, string.count);
+        return;
+    }
+    if (string.count > SIZE_MAX / 2)
+    {
+        fprintf(stderr, "AllocationError: Can not transcode %zu characters of Latin-1 into the buffer.\n", string.count);
+        string_builder_delete(builder);
+        exit(1);
+    }
+    _string_builder_reserve_for(builder, &string, 2 * string.count);
+    char *output = builder->items + builder->size;
+    for (size_t i = 0; i < string.count; i++)
     {
-        string_builder_append(builder, items[i]);
+        const unsigned char byte = (unsigned char) string.data[i];
+        if (byte < 0x80)
+        {
+            *output++ = (char) byte;
+        }
+        else
+        {
+            *output++ = (char) (0xC0 | (byte >> 6));
+            *output++ = (char) (0x80 | (byte & 0x3F));
+        }
     }
+    builder->size = (size_t) (output - builder->items);
 }
 
 /**
@@ -295,17 +643,14 @@ void string_builder_fit(string_builder_t *builder)
 }
 
 /**
- * @brief Fit the capacity of the builder to its size.
- * @param builder Builder to fit.
+ * @brief Append the characters of one buffer to another at once.
+ * @param destination Buffer to which to append.
+ * @param source Buffer from which to append. It may be the destination itself.
  * @exception If the builder can not be reallocated, an `AllocationError` is printed to standard error and the programme exits.
- * @exception If the given index is greater than the size of the builder, an `IndexError` is printed to `stderr` and the programme exits.
  */
 void string_builder_combine(string_builder_t *destination, const string_builder_t *source)
 {
-    for (size_t i = 0; i < source->size; ++i)
-    {
-        string_builder_append(destination, (*string_builder_at(source, i)));
-    }
+    string_builder_append_n(destination, source->items, source->size);
 }
 
 /**
@@ -323,7 +668,6 @@ string_t sbtosv(const string_builder_t *builder)
  * @param builder Buffer from which to remove an element.
  * @param index Index at which the removeable element is located.
  * @exception If the given index is greater than the size of the buffer, an `IndexError` to `stderr` is printed and the programme exits.
- * @exception If the buffer can not be reallocated, an `AllocationError` is printed to `stderr` and the programme exits.
  * @exception If the buffer is evaluated to be empty, a `ValueError` is printed to `stderr` and the programme exits.
  */
 void string_builder_remove(string_builder_t *builder, size_t index)
@@ -340,19 +684,8 @@ void string_builder_remove(string_builder_t *builder, size_t index)
         string_builder_delete(builder);
         exit(1);
     }
-    for (size_t i = index; i < builder->size - 1; i++)
-    {
-        builder->items[i] = builder->items[i + 1];
-    }
+    memmove(builder->items + index, builder->items + index + 1, builder->size - index - 1);
     builder->size--;
-    char *temp = (char *)realloc(builder->items, builder->size * sizeof(char));
-    if (NULL == temp)
-    {
-        fprintf(stderr, "AllocationError: Can not reallocate the buffer.\n");
-        string_builder_delete(builder);
-        exit(1);
-    }
-    builder->items = temp;
 }
 
 /**
@@ -373,14 +706,15 @@ void string_builder_resize(string_builder_t *builder)
  */
 void string_builder_resize_by(string_builder_t *builder, size_t scaler)
 {
-    builder->capacity *= scaler;
-    builder->items = (char *)realloc(builder->items, builder->capacity * sizeof(char *));
-    if (NULL == builder->items)
+    builder->capacity = builder->capacity ? builder->capacity * scaler : STRING_BUILDER_INITIAL_CAPACITY;
+    char *items = (char *)realloc(builder->items, builder->capacity * sizeof(char));
+    if (NULL == items)
     {
         fprintf(stderr, "AllocationError: Can not reallocate the buffer.\n");
         string_builder_delete(builder);
         exit(1);
     }
+    builder->items = items;
 }
 
 /**
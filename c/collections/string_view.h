@@ -7,6 +7,12 @@ extern "C" {
 
 #include <stddef.h> // size_t
 #include <stdbool.h> // bool
+#include <stdint.h> // uint8_t, SIZE_MAX
+
+/**
+ * @brief Index returned by the search functions when nothing is found. It is never a valid index, so it can not be mistaken for a match at the start of a string.
+ */
+#define STRING_NOT_FOUND SIZE_MAX
 
 /**
  * @brief Typedef for a single charactor within a string.
@@ -22,6 +28,36 @@ typedef struct
     const char *data;
 } string_t;
 
+/**
+ * @brief Definition of a set of bytes, such as the delimetres by which to split a string. Besides a bitmap of every byte, the set holds two tables indexed by the low and the high half of a byte, so that 16 or 32 bytes can be classified at once with a byte shuffle.
+ */
+typedef struct
+{
+    uint8_t bitmap[32];
+    uint8_t low[16];
+    uint8_t high[16];
+    bool vector;
+} string_set_t;
+
+/**
+ * @brief Definition of an iterator over the tokens of a string split by a set of delimetres. Tokens are views into the string, so nothing is copied.
+ */
+typedef struct
+{
+    string_t rest;
+    const string_set_t *delimetres;
+    bool done;
+} string_split_t;
+
+/**
+ * @brief Definition of the outcome of parsing a number from the start of a string: how many bytes make up the number, and whether its value is out of the range of the type it was parsed into.
+ */
+typedef struct
+{
+    size_t count;
+    bool overflow;
+} string_parse_t;
+
 /**
  * @brief Macro to allocate a string whose lifetime is that of the entire programme.
  */
@@ -63,14 +99,14 @@ string_t string_new(const char *data, size_t count);
 string_t string_from_literal(const char *cstr);
 
 /**
- * @brief Trim a string of its preceeding spaces.
+ * @brief Trim a string of its preceeding spaces. Spaces are the ASCII whitespace — space, tab, line feed, vertical tab, form feed and carriage return — whatever the locale.
  * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
  * @returns A copy of the same string passed into the function without its preceeding spaces.
  */
 string_t string_trim_left(const string_t *string);
 
 /**
- * @brief Trim a string of its following spaces.
+ * @brief Trim a string of its following spaces. Spaces are the ASCII whitespace — space, tab, line feed, vertical tab, form feed and carriage return — whatever the locale.
  * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
  * @returns A copy of the same string passed into the function without its following spaces.
  */
@@ -83,6 +119,20 @@ string_t string_trim_right(const string_t *string);
  */
 string_t string_trim(const string_t *string);
 
+/**
+ * @brief Copy a given string into a given destination with its ASCII letters in lowercase. Other bytes are copied unchanged.
+ * @param string A pointer to the string to copy.
+ * @param destination A pointer to at least `count` bytes to which to copy. It may be the data of the string itself.
+ */
+void string_copy_lower(const string_t *string, char *destination);
+
+/**
+ * @brief Copy a given string into a given destination with its ASCII letters in uppercase. Other bytes are copied unchanged.
+ * @param string A pointer to the string to copy.
+ * @param destination A pointer to at least `count` bytes to which to copy. It may be the data of the string itself.
+ */
+void string_copy_upper(const string_t *string, char *destination);
+
 /**
  * @brief Chop a string by a given delimetre.
  * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
@@ -92,18 +142,105 @@ string_t string_trim(const string_t *string);
 string_t string_chop_by_delimetre(string_t *string, char delimetre);
 
 /**
- * @brief Find the first occurance of a given charactor within a given string.
+ * @brief Construct a new set from the bytes of a given string.
+ * @param bytes String whose every byte is a member of the set.
+ * @returns A new set of the given bytes.
+ */
+string_set_t string_set_new(string_t bytes);
+
+/**
+ * @brief Determine whether a given charactor is a member of a given set.
+ * @param set A pointer to the set.
+ * @param charactor The charactor to look up.
+ * @returns A boolean on whether the charactor is a member of the set.
+ */
+bool string_set_contains(const string_set_t *set, char_t charactor);
+
+/**
+ * @brief Find the first charactor of a given string that is a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to find.
+ * @returns The index of the first charactor within the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_first_of_any(const string_t *string, const string_set_t *set);
+
+/**
+ * @brief Find the last charactor of a given string that is a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to find.
+ * @returns The index of the last charactor within the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_last_of_any(const string_t *string, const string_set_t *set);
+
+/**
+ * @brief Find the first charactor of a given string that is not a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to skip.
+ * @returns The index of the first charactor outside of the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_first_not_of_any(const string_t *string, const string_set_t *set);
+
+/**
+ * @brief Find the last charactor of a given string that is not a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to skip.
+ * @returns The index of the last charactor outside of the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_last_not_of_any(const string_t *string, const string_set_t *set);
+
+/**
+ * @brief Determine whether every charactor of a given string is a member of a given set, such as whether a field consists of only digits.
+ * @param string A pointer to the string to check.
+ * @param set A pointer to the set of allowed charactors.
+ * @returns A boolean on whether every charactor is within the set. An empty string is always within the set.
+ */
+bool string_is_all_of(const string_t *string, const string_set_t *set);
+
+/**
+ * @brief Chop a string by the first of any of a set of delimetres.
+ * @param string A pointer to the string that needs to be chopped. The chopped chunk and its delimetre are removed from the front of the string.
+ * @param delimetres A pointer to the set of charactors by which to split the string.
+ * @returns A string where the data is set to the first chunk of string before any of the given delimetres.
+ */
+string_t string_chop_by_any(string_t *string, const string_set_t *delimetres);
+
+/**
+ * @brief Construct a new iterator over the tokens of a string split by a set of delimetres.
+ * @param string String to split. The string is not copied, so it must outlive the iterator.
+ * @param delimetres A pointer to the set of charactors by which to split the string. The set must outlive the iterator.
+ * @returns A new split iterator.
+ */
+string_split_t string_split_new(string_t string, const string_set_t *delimetres);
+
+/**
+ * @brief Obtain the next token of a split string. Consecutive delimetres produce empty tokens, and a string with `n` delimetres always produces `n + 1` tokens.
+ * @param split A pointer to the split iterator.
+ * @param token A pointer to which to write the token.
+ * @returns True if a token was written, else false once every token has been produced.
+ */
+bool string_split_next(string_split_t *split, string_t *token);
+
+/**
+ * @brief Chop the next line from the front of a string. A line ends at a line feed, which is removed from the string with it, and a carriage return before the line feed is left out of the line, so both `\n` and `\r\n` endings are handled. The last line does not need to end with a line feed. Lines are views into the string, so nothing is copied.
+ * @param rest A pointer to the string from which to chop the line.
+ * @param line A pointer to which to write the line.
+ * @returns True if a line was written, else false once the string is empty.
+ */
+bool string_next_line(string_t *rest, string_t *line);
+
+/**
+ * @brief Find the first occurance of a given charactor within a given string. Only the first `count` bytes are searched, so the string does not need to be null terminated.
  * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
  * @param charactor The charactor to find within the given string.
- * @returns The index of the given charactor within the given string. Much like the `strchr` function, if the charactor is not found within the string, 0 is returned.
+ * @returns The index of the first occurance of the given charactor within the given string, or `STRING_NOT_FOUND` if the charactor is not found.
  */
 size_t string_find_first_of(const string_t *string, char_t charactor);
 
 /**
- * @brief Find the last occurance of a given charactor within a given string.
+ * @brief Find the last occurance of a given charactor within a given string. Only the first `count` bytes are searched, so the string does not need to be null terminated.
  * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
  * @param charactor The charactor to find within the given string.
- * @returns The index of the given charactor within the given string. Much like the `strrchr` function, if the charactor is not found within the string, 0 is returned.
+ * @returns The index of the last occurance of the given charactor within the given string, or `STRING_NOT_FOUND` if the charactor is not found.
  */
 size_t string_find_last_of(const string_t *string, char_t charactor);
 
@@ -123,6 +260,54 @@ bool string_starts_with(const string_t *string, string_t expected);
  */
 bool string_ends_with(const string_t *string, string_t expected);
 
+/**
+ * @brief Find the first occurance of a given needle within a given haystack. Runs in linear time in the worst case.
+ * @param haystack A pointer to the string to search.
+ * @param needle The string to find.
+ * @returns The index at which the first occurance of the needle starts, `0` if the needle is empty, or `STRING_NOT_FOUND` if the needle is not found.
+ */
+size_t string_find(const string_t *haystack, string_t needle);
+
+/**
+ * @brief Find the last occurance of a given needle within a given haystack. Runs in linear time in the worst case.
+ * @param haystack A pointer to the string to search.
+ * @param needle The string to find.
+ * @returns The index at which the last occurance of the needle starts, the count of the haystack if the needle is empty, or `STRING_NOT_FOUND` if the needle is not found.
+ */
+size_t string_rfind(const string_t *haystack, string_t needle);
+
+/**
+ * @brief Parse an unsigned decimal integer, with an optional leading `+`, from the start of a given string. Nothing past the digits is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to `UINT64_MAX` on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ */
+string_parse_t string_to_u64(const string_t *string, uint64_t *value);
+
+/**
+ * @brief Parse a signed decimal integer, with an optional leading `+` or `-`, from the start of a given string. Nothing past the digits is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to `INT64_MAX` or `INT64_MIN` on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ */
+string_parse_t string_to_i64(const string_t *string, int64_t *value);
+
+/**
+ * @brief Parse a decimal floating point number, such as `-12.5e-3`, `inf` or `nan`, from the start of a given string. The result is correctly rounded. Nothing past the number is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to an infinity on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ */
+string_parse_t string_to_f64(const string_t *string, double *value);
+
+/**
+ * @brief Hash a given string into 64 bits with the wyhash algorithm. The hash is not cryptographic, but it is fast, well distributed, and different seeds give unrelated hashes.
+ * @param string The string to hash.
+ * @param seed The seed with which to hash.
+ * @returns The 64-bit hash of the string.
+ */
+uint64_t string_hash(string_t string, uint64_t seed);
+
 /**
  * @brief Compare two given — case sensitive — string types.
  * @param a The string to check against.
@@ -131,6 +316,43 @@ bool string_ends_with(const string_t *string, string_t expected);
  */
 bool string_equals(string_t a, string_t b);
 
+/**
+ * @brief Compare two given string types, ignoring the case of ASCII letters.
+ * @param a The string to check against.
+ * @param b The string to which a comparison will be made in parametre `a`.
+ * @returns A boolean on wheather `a` and `b` are equal once their ASCII letters are folded to one case.
+ */
+bool string_equals_ignore_case(string_t a, string_t b);
+
+/**
+ * @brief Determine whether every byte of a given string is ASCII, that is below `0x80`.
+ * @param string A pointer to the string to check.
+ * @returns A boolean on whether the string is ASCII. An empty string is ASCII.
+ */
+bool string_is_ascii(const string_t *string);
+
+/**
+ * @brief Determine whether a given string is valid UTF-8: no overlong encodings, no surrogates, nothing above `U+10FFFF`, and no sequence cut short. On x86-64 processors with SSSE3, 16 or, with AVX2, 32 bytes are validated at a time.
+ * @param string A pointer to the string to validate.
+ * @returns A boolean on whether the string is valid UTF-8. An empty string is valid.
+ */
+bool string_is_valid_utf8(const string_t *string);
+
+/**
+ * @brief Count the code points of a given string of valid UTF-8, which is the number of bytes that are not continuations.
+ * @param string A pointer to the string to count.
+ * @returns The number of code points within the string.
+ */
+size_t string_utf8_count(const string_t *string);
+
+/**
+ * @brief Decode the next code point of a given string of UTF-8 and remove it from the front of the string. An invalid sequence decodes to the replacement charactor `U+FFFD`, and only the longest prefix of it that could have started a valid sequence — at least one byte — is removed.
+ * @param string A pointer to the string to decode.
+ * @param code_point A pointer to which to write the code point.
+ * @returns True if a code point was written, else false once the string is empty.
+ */
+bool string_utf8_next(string_t *string, char_t *code_point);
+
 /**
  * @brief Determine if the the given string is empty.
  * @param string String to evaluate.
@@ -138,188 +360,3245 @@ bool string_equals(string_t a, string_t b);
  */
 bool string_is_empty(string_t string);
 
+#if defined(__cplusplus)
+}
+#endif
+
 #endif // STRING_VIEW_H
 
-#ifdef STRING_VIEW_IMPLEMENTATION
+#if defined(STRING_VIEW_IMPLEMENTATION) && !defined(STRING_VIEW_IMPLEMENTED)
+#define STRING_VIEW_IMPLEMENTED
 
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
-#include <string.h> // strlen, strchr, strrchr, memcmp, NULL
-#include <ctype.h> // isspace
+#include <stdlib.h> // malloc, free, exit, strtod
+#include <stdio.h> // fprintf, stderr
+#include <string.h> // strlen, memchr, memcmp, memcpy, memset, NULL
+#include <ctype.h> // tolower
+#include <float.h> // FLT_EVAL_METHOD
+#include <math.h> // HUGE_VAL, NAN, isinf
+
+#ifndef STRING_VIEW_SIMD
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define STRING_VIEW_SIMD 1
+#else
+#define STRING_VIEW_SIMD 0
+#endif
+#endif // STRING_VIEW_SIMD
+
+#if STRING_VIEW_SIMD
+#include <immintrin.h> // __m128i, __m256i, _mm_*, _mm256_*
 
 /**
- * @brief Constructor for a new string with a given length and data.
- * @param data A char pointer marked with const that is directly added to the structure.
- * @param count The provided length of the given data.
- * @returns A new string with a given count and data.
+ * @brief Determine whether the processor supports AVX2. SSE2 is part of x86-64, so it is always available.
+ * @returns True if AVX2 kernels can be used, else false.
  */
-string_t string_new(const char *data, size_t count)
+static bool _string_has_avx2(void)
 {
-    string_t string = {0};
-    string.count = count;
-    string.data = data;
-    return string;
+    return __builtin_cpu_supports("avx2");
 }
 
 /**
- * @brief Allocate a new string structure from a c-string literal marked with const.
- * @param cstr A char pointer marked with const to be passed to the `new_string` function that was previously defined.
- * @returns A new string with data as the given cstr and the `strlen` count.
+ * @brief Determine whether the processor supports SSSE3, which adds the byte shuffle used to classify bytes against a set.
+ * @returns True if SSSE3 kernels can be used, else false.
  */
-string_t string_from_literal(const char *cstr)
+static bool _string_has_ssse3(void)
 {
-    return string_new(cstr, strlen(cstr));
+    return __builtin_cpu_supports("ssse3");
 }
 
 /**
- * @brief Trim a string of its preceeding spaces.
- * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @returns A copy of the same string passed into the function without its preceeding spaces.
+ * @brief Find the first occurance of a byte within at least 16 bytes, 16 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 16.
+ * @param byte Byte to find.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
  */
-string_t string_trim_left(const string_t *string)
+static size_t _string_find_byte_sse2(const char *data, size_t count, char byte)
 {
+    const __m128i needle = _mm_set1_epi8(byte);
     size_t i = 0;
-    while (i < string->count && isspace(string->data[i]))
+    for (; i + 16 <= count; i += 16)
     {
-        i++;
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + i)), needle));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz((unsigned int) mask);
+        }
     }
-    return string_new(string->data + i, string->count - i);
+    if (i < count)
+    {
+        // The last block overlaps bytes already searched, none of which matched.
+        i = count - 16;
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + i)), needle));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz((unsigned int) mask);
+        }
+    }
+    return STRING_NOT_FOUND;
 }
 
 /**
- * @brief Trim a string of its following spaces.
- * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @returns A copy of the same string passed into the function without its following spaces.
+ * @brief Find the last occurance of a byte within at least 16 bytes, 16 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 16.
+ * @param byte Byte to find.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
  */
-string_t string_trim_right(const string_t *string)
+static size_t _string_rfind_byte_sse2(const char *data, size_t count, char byte)
+{
+    const __m128i needle = _mm_set1_epi8(byte);
+    size_t i = count;
+    for (; i >= 16; i -= 16)
+    {
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + i - 16)), needle));
+        if (mask)
+        {
+            return i - 16 + (size_t) (31 - __builtin_clz((unsigned int) mask));
+        }
+    }
+    if (i > 0)
+    {
+        // The first block overlaps bytes already searched, none of which matched.
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) data), needle));
+        if (mask)
+        {
+            return (size_t) (31 - __builtin_clz((unsigned int) mask));
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Find the first occurance of a byte within at least 32 bytes, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 32.
+ * @param byte Byte to find.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
+ */
+__attribute__((target("avx2")))
+static size_t _string_find_byte_avx2(const char *data, size_t count, char byte)
 {
+    const __m256i needle = _mm256_set1_epi8(byte);
     size_t i = 0;
-    while (i < string->count && isspace(string->data[string->count - 1 - i]))
+    for (; i + 32 <= count; i += 32)
+    {
+        const unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + i)), needle));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
+    }
+    if (i < count)
     {
-        i++;
+        i = count - 32;
+        const unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + i)), needle));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
     }
-    return string_new(string->data, string->count - i);
+    return STRING_NOT_FOUND;
 }
 
 /**
- * @brief Trim a string of both its preceeding and following spaces. This function is a combination of both the `string_trim_left` and the `string_trim_right` functions. This function is similar to the default behaviour of Python's `string.strip()` function.
- * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @returns A copy of the same string passed into the function without its preceeding or following spaces.
+ * @brief Find the last occurance of a byte within at least 32 bytes, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 32.
+ * @param byte Byte to find.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
  */
-string_t string_trim(const string_t *string)
+__attribute__((target("avx2")))
+static size_t _string_rfind_byte_avx2(const char *data, size_t count, char byte)
 {
-    string_t left_trim = string_trim_left(string);
-    return string_trim_right(&left_trim);
+    const __m256i needle = _mm256_set1_epi8(byte);
+    size_t i = count;
+    for (; i >= 32; i -= 32)
+    {
+        const unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + i - 32)), needle));
+        if (mask)
+        {
+            return i - 32 + (size_t) (31 - __builtin_clz(mask));
+        }
+    }
+    if (i > 0)
+    {
+        const unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) data), needle));
+        if (mask)
+        {
+            return (size_t) (31 - __builtin_clz(mask));
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+/**
+ * @brief Classify 16 bytes against a set: a byte is a member if the entries of the low and the high table for its two halves share a bit.
+ * @param block Bytes to classify.
+ * @param low Table indexed by the low half of a byte.
+ * @param high Table indexed by the high half of a byte.
+ * @returns A mask with one bit set for every member.
+ */
+__attribute__((target("ssse3")))
+static unsigned int _string_set_classify_ssse3(__m128i block, __m128i low, __m128i high)
+{
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i lows = _mm_shuffle_epi8(low, _mm_and_si128(block, nibble));
+    const __m128i highs = _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(block, 4), nibble));
+    const __m128i members = _mm_and_si128(lows, highs);
+    return ~(unsigned int) _mm_movemask_epi8(_mm_cmpeq_epi8(members, _mm_setzero_si128())) & 0xFFFFu;
 }
 
 /**
- * @brief Chop a string by a given delimetre.
- * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @param delimetre A charactor by which to split the string.
- * @returns A string where the data is set to the first chunk of string before the given delimetre.
+ * @brief Find the first member — or non-member — of a set within at least 16 bytes, 16 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 16.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the first match, or `STRING_NOT_FOUND`.
  */
-string_t string_chop_by_delimetre(string_t *string, char delimetre)
+__attribute__((target("ssse3")))
+static size_t _string_find_set_ssse3(const char *data, size_t count, const string_set_t *set, bool member)
 {
+    const __m128i low = _mm_loadu_si128((const __m128i *) set->low);
+    const __m128i high = _mm_loadu_si128((const __m128i *) set->high);
+    const unsigned int flip = member ? 0 : 0xFFFFu;
     size_t i = 0;
-    while (i < string->count && string->data[i] != delimetre)
+    for (; i + 16 <= count; i += 16)
     {
-        i++;
+        const unsigned int mask = _string_set_classify_ssse3(_mm_loadu_si128((const __m128i *) (data + i)), low, high) ^ flip;
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
     }
-    string_t result = string_new(string->data, i);
-    if (i < string->count)
+    if (i < count)
     {
-        string->count -= i + 1;
-        string->data += i + 1;
+        // The last block overlaps bytes already searched, none of which matched.
+        i = count - 16;
+        const unsigned int mask = _string_set_classify_ssse3(_mm_loadu_si128((const __m128i *) (data + i)), low, high) ^ flip;
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
     }
-    else
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Find the last member — or non-member — of a set within at least 16 bytes, 16 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 16.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the last match, or `STRING_NOT_FOUND`.
+ */
+__attribute__((target("ssse3")))
+static size_t _string_rfind_set_ssse3(const char *data, size_t count, const string_set_t *set, bool member)
+{
+    const __m128i low = _mm_loadu_si128((const __m128i *) set->low);
+    const __m128i high = _mm_loadu_si128((const __m128i *) set->high);
+    const unsigned int flip = member ? 0 : 0xFFFFu;
+    size_t i = count;
+    for (; i >= 16; i -= 16)
     {
-        string->count -= i;
-        string->data += i;
+        const unsigned int mask = _string_set_classify_ssse3(_mm_loadu_si128((const __m128i *) (data + i - 16)), low, high) ^ flip;
+        if (mask)
+        {
+            return i - 16 + (size_t) (31 - __builtin_clz(mask));
+        }
     }
-    return result;
+    if (i > 0)
+    {
+        // The first block overlaps bytes already searched, none of which matched.
+        const unsigned int mask = _string_set_classify_ssse3(_mm_loadu_si128((const __m128i *) data), low, high) ^ flip;
+        if (mask)
+        {
+            return (size_t) (31 - __builtin_clz(mask));
+        }
+    }
+    return STRING_NOT_FOUND;
 }
 
 /**
- * @brief Find the first occurance of a given charactor within a given string.
- * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @param charactor The charactor to find within the given string.
- * @returns The index of the given charactor within the given string. Much like the `strchr` function, if the charactor is not found within the string, 0 is returned.
+ * @brief Classify 32 bytes against a set. The shuffle works within each 16-byte lane, so both tables are repeated in both lanes.
+ * @param block Bytes to classify.
+ * @param low Table indexed by the low half of a byte.
+ * @param high Table indexed by the high half of a byte.
+ * @returns A mask with one bit set for every member.
  */
-size_t string_find_first_of(const string_t *string, char_t charactor)
+__attribute__((target("avx2")))
+static unsigned int _string_set_classify_avx2(__m256i block, __m256i low, __m256i high)
+{
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i lows = _mm256_shuffle_epi8(low, _mm256_and_si256(block, nibble));
+    const __m256i highs = _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble));
+    const __m256i members = _mm256_and_si256(lows, highs);
+    return ~(unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(members, _mm256_setzero_si256()));
+}
+
+/**
+ * @brief Find the first member — or non-member — of a set within at least 32 bytes, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 32.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the first match, or `STRING_NOT_FOUND`.
+ */
+__attribute__((target("avx2")))
+static size_t _string_find_set_avx2(const char *data, size_t count, const string_set_t *set, bool member)
 {
-    const char *result = strchr(string->data, charactor);
-    const size_t full_length = strlen(string->data);
-    if (!result)
+    const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->low));
+    const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->high));
+    const unsigned int flip = member ? 0 : 0xFFFFFFFFu;
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
     {
-        return 0;
+        const unsigned int mask = _string_set_classify_avx2(_mm256_loadu_si256((const __m256i *) (data + i)), low, high) ^ flip;
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
     }
-    return full_length - strlen(result);
+    if (i < count)
+    {
+        i = count - 32;
+        const unsigned int mask = _string_set_classify_avx2(_mm256_loadu_si256((const __m256i *) (data + i)), low, high) ^ flip;
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz(mask);
+        }
+    }
+    return STRING_NOT_FOUND;
 }
 
 /**
- * @brief Find the last occurance of a given charactor within a given string.
- * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @param charactor The charactor to find within the given string.
- * @returns The index of the given charactor within the given string. Much like the `strrchr` function, if the charactor is not found within the string, 0 is returned.
+ * @brief Find the last member — or non-member — of a set within at least 32 bytes, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 32.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the last match, or `STRING_NOT_FOUND`.
  */
-size_t string_find_last_of(const string_t *string, char_t charactor)
+__attribute__((target("avx2")))
+static size_t _string_rfind_set_avx2(const char *data, size_t count, const string_set_t *set, bool member)
 {
-    const char *result = strrchr(string->data, charactor);
-    const size_t full_length = strlen(string->data);
-    if (!result)
+    const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->low));
+    const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) set->high));
+    const unsigned int flip = member ? 0 : 0xFFFFFFFFu;
+    size_t i = count;
+    for (; i >= 32; i -= 32)
     {
-        return 0;
+        const unsigned int mask = _string_set_classify_avx2(_mm256_loadu_si256((const __m256i *) (data + i - 32)), low, high) ^ flip;
+        if (mask)
+        {
+            return i - 32 + (size_t) (31 - __builtin_clz(mask));
+        }
+    }
+    if (i > 0)
+    {
+        const unsigned int mask = _string_set_classify_avx2(_mm256_loadu_si256((const __m256i *) data), low, high) ^ flip;
+        if (mask)
+        {
+            return (size_t) (31 - __builtin_clz(mask));
+        }
     }
-    return full_length - strlen(result);
+    return STRING_NOT_FOUND;
 }
 
 /**
- * @brief Determine whether a given string starts with a given expected string.
- * @param string A pointer to the string that contains the given string. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @param expected The expected prefix to check against.
- * @returns A boolean on whether `string` starts with `expected`.
+ * @brief Select the bytes of a block that lie within a range of 26 letters, by comparing their distance from its first letter without sign.
+ * @param block Bytes to select from.
+ * @param first Splat of the first letter of the range, either `A` or `a`.
+ * @returns A block with every byte of a letter set to `0x20`, the bit that tells the cases apart, and every other byte cleared.
  */
-bool string_starts_with(const string_t *string, string_t expected)
+static __m128i _string_letters_sse2(__m128i block, __m128i first)
 {
-    if (expected.count > string->count)
+    const __m128i offset = _mm_sub_epi8(block, first);
+    const __m128i letters = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+    return _mm_and_si128(letters, _mm_set1_epi8(0x20));
+}
+
+/**
+ * @brief Compare at least 16 bytes of two ranges, ignoring the case of ASCII letters, 16 bytes at a time.
+ * @param a Pointer to the first byte of the first range.
+ * @param b Pointer to the first byte of the second range.
+ * @param count Number of bytes within both ranges, which must be at least 16.
+ * @returns True if the ranges are equal once folded to lowercase, else false.
+ */
+static bool _string_equals_ignore_case_sse2(const char *a, const char *b, size_t count)
+{
+    const __m128i first = _mm_set1_epi8('A');
+    size_t i = 0;
+    for (;; i += 16)
     {
-        return false;
+        // The last block overlaps bytes already compared, all of which were equal.
+        i = i + 16 <= count ? i : count - 16;
+        const __m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+        const __m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+        const __m128i lower_x = _mm_or_si128(x, _string_letters_sse2(x, first));
+        const __m128i lower_y = _mm_or_si128(y, _string_letters_sse2(y, first));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(lower_x, lower_y)) != 0xFFFF)
+        {
+            return false;
+        }
+        if (i + 16 == count)
+        {
+            return true;
+        }
     }
-    string_t actual = string_new(string->data, expected.count);
-    return string_equals(expected, actual);
 }
 
 /**
- * @brief Determine whether a given string ends with a given expected string.
- * @param string A pointer to the string that contains the given string. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
- * @param expected The expected suffix to check against.
- * @returns A boolean on whether `string` ends with `expected`.
+ * @brief Copy at least 16 bytes while flipping the case of the letters of one case, 16 bytes at a time.
+ * @param source Pointer to the first byte to copy.
+ * @param destination Pointer to where the bytes are copied, which may be the source itself.
+ * @param count Number of bytes, which must be at least 16.
+ * @param first First letter of the case to flip: `A` to lowercase, or `a` to uppercase.
  */
-bool string_ends_with(const string_t *string, string_t expected)
+static void _string_fold_case_sse2(const char *source, char *destination, size_t count, char first)
 {
-    if (expected.count > string->count)
+    const __m128i start = _mm_set1_epi8(first);
+    size_t i = 0;
+    for (;; i += 16)
     {
-        return false;
+        // The last block overlaps bytes already copied; folding them again changes nothing.
+        i = i + 16 <= count ? i : count - 16;
+        const __m128i block = _mm_loadu_si128((const __m128i *) (source + i));
+        _mm_storeu_si128((__m128i *) (destination + i), _mm_xor_si128(block, _string_letters_sse2(block, start)));
+        if (i + 16 == count)
+        {
+            return;
+        }
     }
-    string_t actual = string_new(string->data + string->count - expected.count, expected.count);
-    return string_equals(expected, actual);
 }
 
 /**
- * @brief Compare two given — case sensitive — string types.
- * @param a The string to check against.
- * @param b The string to which a comparison will be made in parametre `a`.
- * @returns A boolean on wheather `a` and `b` are equal.
+ * @brief Select the bytes of a block that lie within a range of 26 letters, 32 bytes at a time.
+ * @param block Bytes to select from.
+ * @param first Splat of the first letter of the range, either `A` or `a`.
+ * @returns A block with every byte of a letter set to `0x20` and every other byte cleared.
  */
-bool string_equals(string_t a, string_t b)
+__attribute__((target("avx2")))
+static __m256i _string_letters_avx2(__m256i block, __m256i first)
 {
-    if (a.count != b.count)
+    const __m256i offset = _mm256_sub_epi8(block, first);
+    const __m256i letters = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+    return _mm256_and_si256(letters, _mm256_set1_epi8(0x20));
+}
+
+/**
+ * @brief Compare at least 32 bytes of two ranges, ignoring the case of ASCII letters, 32 bytes at a time.
+ * @param a Pointer to the first byte of the first range.
+ * @param b Pointer to the first byte of the second range.
+ * @param count Number of bytes within both ranges, which must be at least 32.
+ * @returns True if the ranges are equal once folded to lowercase, else false.
+ */
+__attribute__((target("avx2")))
+static bool _string_equals_ignore_case_avx2(const char *a, const char *b, size_t count)
+{
+    const __m256i first = _mm256_set1_epi8('A');
+    size_t i = 0;
+    for (;; i += 32)
     {
-        return false;
+        i = i + 32 <= count ? i : count - 32;
+        const __m256i x = _mm256_loadu_si256((const __m256i *) (a + i));
+        const __m256i y = _mm256_loadu_si256((const __m256i *) (b + i));
+        const __m256i lower_x = _mm256_or_si256(x, _string_letters_avx2(x, first));
+        const __m256i lower_y = _mm256_or_si256(y, _string_letters_avx2(y, first));
+        if ((unsigned int) _mm256_movemask_epi8(_mm256_cmpeq_epi8(lower_x, lower_y)) != 0xFFFFFFFFu)
+        {
+            return false;
+        }
+        if (i + 32 == count)
+        {
+            return true;
+        }
     }
-    return memcmp(a.data, b.data, a.count) == 0;
+}
+
+/**
+ * @brief Copy at least 32 bytes while flipping the case of the letters of one case, 32 bytes at a time.
+ * @param source Pointer to the first byte to copy.
+ * @param destination Pointer to where the bytes are copied, which may be the source itself.
+ * @param count Number of bytes, which must be at least 32.
+ * @param first First letter of the case to flip: `A` to lowercase, or `a` to uppercase.
+ */
+__attribute__((target("avx2")))
+static void _string_fold_case_avx2(const char *source, char *destination, size_t count, char first)
+{
+    const __m256i start = _mm256_set1_epi8(first);
+    size_t i = 0;
+    for (;; i += 32)
+    {
+        i = i + 32 <= count ? i : count - 32;
+        const __m256i block = _mm256_loadu_si256((const __m256i *) (source + i));
+        _mm256_storeu_si256((__m256i *) (destination + i), _mm256_xor_si256(block, _string_letters_avx2(block, start)));
+        if (i + 32 == count)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Find the first byte of at least 16 bytes that is not ASCII, 16 bytes at a time. Such a byte has its high bit set, which is exactly what the byte mask gathers.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least 16.
+ * @returns The index of the first byte that is not ASCII, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_find_non_ascii_sse2(const char *data, size_t count)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (data + i)));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz((unsigned int) mask);
+        }
+    }
+    if (i < count)
+    {
+        i = count - 16;
+        const int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (data + i)));
+        if (mask)
+        {
+            return i + (size_t) __builtin_ctz((unsigned int) mask);
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+
+/**
+ * @brief Error classes of the UTF-8 validator, each a bit of the lookup tables. A pair of neighbouring bytes is invalid when the tables for the high half of the first byte, the low half of the first byte and the high half of the second byte share a bit.
+ */
+#define _STRING_UTF8_TOO_SHORT (1 << 0)
+#define _STRING_UTF8_TOO_LONG (1 << 1)
+#define _STRING_UTF8_OVERLONG_3 (1 << 2)
+#define _STRING_UTF8_TOO_LARGE (1 << 3)
+#define _STRING_UTF8_SURROGATE (1 << 4)
+#define _STRING_UTF8_OVERLONG_2 (1 << 5)
+#define _STRING_UTF8_TOO_LARGE_1000 (1 << 6)
+#define _STRING_UTF8_OVERLONG_4 (1 << 6)
+#define _STRING_UTF8_TWO_CONTINUATIONS (1 << 7)
+#define _STRING_UTF8_CARRY (_STRING_UTF8_TOO_SHORT | _STRING_UTF8_TOO_LONG | _STRING_UTF8_TWO_CONTINUATIONS)
+
+/**
+ * @brief Errors possible for each high half of the first byte of a pair.
+ */
+static const uint8_t _string_utf8_first_high[16] = {
+    // An ASCII byte can not be followed by a continuation.
+    _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG,
+    _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG, _STRING_UTF8_TOO_LONG,
+    // A continuation may only be followed by another if a lead of three or four bytes came before.
+    _STRING_UTF8_TWO_CONTINUATIONS, _STRING_UTF8_TWO_CONTINUATIONS, _STRING_UTF8_TWO_CONTINUATIONS, _STRING_UTF8_TWO_CONTINUATIONS,
+    // Leads of two, three and four bytes must be followed by a continuation.
+    _STRING_UTF8_TOO_SHORT | _STRING_UTF8_OVERLONG_2,
+    _STRING_UTF8_TOO_SHORT,
+    _STRING_UTF8_TOO_SHORT | _STRING_UTF8_OVERLONG_3 | _STRING_UTF8_SURROGATE,
+    _STRING_UTF8_TOO_SHORT | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000 | _STRING_UTF8_OVERLONG_4
+};
+
+/**
+ * @brief Errors possible for each low half of the first byte of a pair.
+ */
+static const uint8_t _string_utf8_first_low[16] = {
+    _STRING_UTF8_CARRY | _STRING_UTF8_OVERLONG_3 | _STRING_UTF8_OVERLONG_2 | _STRING_UTF8_OVERLONG_4,
+    _STRING_UTF8_CARRY | _STRING_UTF8_OVERLONG_2,
+    _STRING_UTF8_CARRY,
+    _STRING_UTF8_CARRY,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000 | _STRING_UTF8_SURROGATE,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000,
+    _STRING_UTF8_CARRY | _STRING_UTF8_TOO_LARGE | _STRING_UTF8_TOO_LARGE_1000
+};
+
+/**
+ * @brief Errors possible for each high half of the second byte of a pair.
+ */
+static const uint8_t _string_utf8_second_high[16] = {
+    _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT,
+    _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT,
+    _STRING_UTF8_TOO_LONG | _STRING_UTF8_OVERLONG_2 | _STRING_UTF8_TWO_CONTINUATIONS | _STRING_UTF8_OVERLONG_3 | _STRING_UTF8_TOO_LARGE_1000 | _STRING_UTF8_OVERLONG_4,
+    _STRING_UTF8_TOO_LONG | _STRING_UTF8_OVERLONG_2 | _STRING_UTF8_TWO_CONTINUATIONS | _STRING_UTF8_OVERLONG_3 | _STRING_UTF8_TOO_LARGE,
+    _STRING_UTF8_TOO_LONG | _STRING_UTF8_OVERLONG_2 | _STRING_UTF8_TWO_CONTINUATIONS | _STRING_UTF8_SURROGATE | _STRING_UTF8_TOO_LARGE,
+    _STRING_UTF8_TOO_LONG | _STRING_UTF8_OVERLONG_2 | _STRING_UTF8_TWO_CONTINUATIONS | _STRING_UTF8_SURROGATE | _STRING_UTF8_TOO_LARGE,
+    _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT, _STRING_UTF8_TOO_SHORT
+};
+
+/**
+ * @brief Thresholds above which one of the last three bytes of a block starts a sequence that continues past the block: a lead of four bytes in the third to last, of three or more in the second to last, or of any length in the last.
+ */
+static const uint8_t _string_utf8_incomplete[32] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+/**
+ * @brief Validate 16 bytes of UTF-8 with the algorithm of Keiser and Lemire. Every pair of neighbouring bytes is classified with three table lookups, and the bytes that must be the third or fourth of a sequence are checked against the continuations found.
+ * @param block Bytes to validate.
+ * @param previous The previous block, or zeros before the first.
+ * @param incomplete A pointer to the mask of sequences left incomplete by the previous block, which is updated for this block.
+ * @returns A block which is non-zero if the bytes are invalid.
+ */
+__attribute__((target("ssse3")))
+static __m128i _string_utf8_check_ssse3(__m128i block, __m128i previous, __m128i *incomplete)
+{
+    if (_mm_movemask_epi8(block) == 0)
+    {
+        // An ASCII block is valid by itself, but must not follow an incomplete sequence.
+        const __m128i error = *incomplete;
+        *incomplete = _mm_setzero_si128();
+        return error;
+    }
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i first = _mm_alignr_epi8(block, previous, 15);
+    const __m128i first_high = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) _string_utf8_first_high), _mm_and_si128(_mm_srli_epi16(first, 4), nibble));
+    const __m128i first_low = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) _string_utf8_first_low), _mm_and_si128(first, nibble));
+    const __m128i second_high = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) _string_utf8_second_high), _mm_and_si128(_mm_srli_epi16(block, 4), nibble));
+    const __m128i special = _mm_and_si128(_mm_and_si128(first_high, first_low), second_high);
+    // Only a lead of three or four bytes two or three bytes back leaves its high bit after the saturating subtraction.
+    const __m128i third = _mm_subs_epu8(_mm_alignr_epi8(block, previous, 14), _mm_set1_epi8((char) (0xE0 - 0x80)));
+    const __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(block, previous, 13), _mm_set1_epi8((char) (0xF0 - 0x80)));
+    const __m128i required = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char) 0x80));
+    *incomplete = _mm_subs_epu8(block, _mm_loadu_si128((const __m128i *) (_string_utf8_incomplete + 16)));
+    return _mm_xor_si128(required, special);
+}
+
+/**
+ * @brief Validate a range of UTF-8, 16 bytes at a time. The last partial block is copied into a block padded with zeros, which are ASCII, so a sequence cut short by the end is caught like any other.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @returns True if the range is valid UTF-8, else false.
+ */
+__attribute__((target("ssse3")))
+static bool _string_is_valid_utf8_ssse3(const char *data, size_t count)
+{
+    __m128i error = _mm_setzero_si128();
+    __m128i previous = _mm_setzero_si128();
+    __m128i incomplete = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i block = _mm_loadu_si128((const __m128i *) (data + i));
+        error = _mm_or_si128(error, _string_utf8_check_ssse3(block, previous, &incomplete));
+        previous = block;
+    }
+    if (i < count)
+    {
+        char tail[16] = {0};
+        memcpy(tail, data + i, count - i);
+        error = _mm_or_si128(error, _string_utf8_check_ssse3(_mm_loadu_si128((const __m128i *) tail), previous, &incomplete));
+    }
+    error = _mm_or_si128(error, incomplete);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+/**
+ * @brief Validate 32 bytes of UTF-8 with the algorithm of Keiser and Lemire. The bytes preceding each lane are gathered from the previous block, since the byte alignment works within each 16-byte lane.
+ * @param block Bytes to validate.
+ * @param previous The previous block, or zeros before the first.
+ * @param incomplete A pointer to the mask of sequences left incomplete by the previous block, which is updated for this block.
+ * @returns A block which is non-zero if the bytes are invalid.
+ */
+__attribute__((target("avx2")))
+static __m256i _string_utf8_check_avx2(__m256i block, __m256i previous, __m256i *incomplete)
+{
+    if (_mm256_movemask_epi8(block) == 0)
+    {
+        const __m256i error = *incomplete;
+        *incomplete = _mm256_setzero_si256();
+        return error;
+    }
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i shifted = _mm256_permute2x128_si256(previous, block, 0x21);
+    const __m256i first = _mm256_alignr_epi8(block, shifted, 15);
+    const __m256i first_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) _string_utf8_first_high)), _mm256_and_si256(_mm256_srli_epi16(first, 4), nibble));
+    const __m256i first_low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) _string_utf8_first_low)), _mm256_and_si256(first, nibble));
+    const __m256i second_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) _string_utf8_second_high)), _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble));
+    const __m256i special = _mm256_and_si256(_mm256_and_si256(first_high, first_low), second_high);
+    const __m256i third = _mm256_subs_epu8(_mm256_alignr_epi8(block, shifted, 14), _mm256_set1_epi8((char) (0xE0 - 0x80)));
+    const __m256i fourth = _mm256_subs_epu8(_mm256_alignr_epi8(block, shifted, 13), _mm256_set1_epi8((char) (0xF0 - 0x80)));
+    const __m256i required = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char) 0x80));
+    *incomplete = _mm256_subs_epu8(block, _mm256_loadu_si256((const __m256i *) _string_utf8_incomplete));
+    return _mm256_xor_si256(required, special);
+}
+
+/**
+ * @brief Validate a range of UTF-8, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @returns True if the range is valid UTF-8, else false.
+ */
+__attribute__((target("avx2")))
+static bool _string_is_valid_utf8_avx2(const char *data, size_t count)
+{
+    __m256i error = _mm256_setzero_si256();
+    __m256i previous = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i block = _mm256_loadu_si256((const __m256i *) (data + i));
+        error = _mm256_or_si256(error, _string_utf8_check_avx2(block, previous, &incomplete));
+        previous = block;
+    }
+    if (i < count)
+    {
+        char tail[32] = {0};
+        memcpy(tail, data + i, count - i);
+        error = _mm256_or_si256(error, _string_utf8_check_avx2(_mm256_loadu_si256((const __m256i *) tail), previous, &incomplete));
+    }
+    error = _mm256_or_si256(error, incomplete);
+    return _mm256_testz_si256(error, error);
+}
+
+/**
+ * @brief Count the bytes of a range that are not continuations, 16 bytes at a time. Continuations are `0x80` to `0xBF`, which are all below `-64` as signed bytes.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @returns The number of bytes which are not continuations within the whole blocks; the rest are left to the caller.
+ */
+static size_t _string_utf8_count_sse2(const char *data, size_t count)
+{
+    const __m128i threshold = _mm_set1_epi8((char) 0xBF);
+    size_t result = 0;
+    for (size_t i = 0; i + 16 <= count; i += 16)
+    {
+        const __m128i leads = _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *) (data + i)), threshold);
+        result += (size_t) __builtin_popcount((unsigned int) _mm_movemask_epi8(leads));
+    }
+    return result;
+}
+
+/**
+ * @brief Count the bytes of a range that are not continuations, 32 bytes at a time.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @returns The number of bytes which are not continuations within the whole blocks; the rest are left to the caller.
+ */
+__attribute__((target("avx2,popcnt")))
+static size_t _string_utf8_count_avx2(const char *data, size_t count)
+{
+    const __m256i threshold = _mm256_set1_epi8((char) 0xBF);
+    size_t result = 0;
+    for (size_t i = 0; i + 32 <= count; i += 32)
+    {
+        const __m256i leads = _mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i *) (data + i)), threshold);
+        result += (size_t) __builtin_popcount((unsigned int) _mm256_movemask_epi8(leads));
+    }
+    return result;
+}
+
+#endif // STRING_VIEW_SIMD
+
+/**
+ * @brief Find the first occurance of a byte within a range, never reading past its end.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @param byte Byte to find.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_find_byte(const char *data, size_t count, char byte)
+{
+#if STRING_VIEW_SIMD
+    if (count >= 32 && _string_has_avx2())
+    {
+        return _string_find_byte_avx2(data, count, byte);
+    }
+    if (count >= 16)
+    {
+        return _string_find_byte_sse2(data, count, byte);
+    }
+#endif // STRING_VIEW_SIMD
+    const char *match = count > 0 ? (const char *) memchr(data, byte, count) : NULL;
+    return match ? (size_t) (match - data) : STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Find the last occurance of a byte within a range, never reading past its end.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @param byte Byte to find.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_rfind_byte(const char *data, size_t count, char byte)
+{
+#if STRING_VIEW_SIMD
+    if (count >= 32 && _string_has_avx2())
+    {
+        return _string_rfind_byte_avx2(data, count, byte);
+    }
+    if (count >= 16)
+    {
+        return _string_rfind_byte_sse2(data, count, byte);
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = count; i > 0; i--)
+    {
+        if (data[i - 1] == byte)
+        {
+            return i - 1;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Set of the ASCII whitespace — space, tab, line feed, vertical tab, form feed and carriage return — which are the bytes that `isspace` accepts in the C locale. It is equal to `string_set_new(string_from_literal(" \t\n\v\f\r"))`.
+ */
+static const string_set_t _string_spaces = {
+    {0, 0x3E, 0, 0, 0x01},
+    {2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0},
+    {1, 0, 2},
+    true
+};
+
+/**
+ * @brief Find the first member — or non-member — of a set within a range, never reading past its end.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the first match, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_find_set(const char *data, size_t count, const string_set_t *set, bool member)
+{
+#if STRING_VIEW_SIMD
+    if (set->vector && count >= 32 && _string_has_avx2())
+    {
+        return _string_find_set_avx2(data, count, set, member);
+    }
+    if (set->vector && count >= 16 && _string_has_ssse3())
+    {
+        return _string_find_set_ssse3(data, count, set, member);
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = 0; i < count; i++)
+    {
+        if (string_set_contains(set, data[i]) == member)
+        {
+            return i;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Find the last member — or non-member — of a set within a range, never reading past its end.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @param set Set of the bytes to classify against.
+ * @param member Whether to find a member of the set rather than a byte outside of it.
+ * @returns The index of the last match, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_rfind_set(const char *data, size_t count, const string_set_t *set, bool member)
+{
+#if STRING_VIEW_SIMD
+    if (set->vector && count >= 32 && _string_has_avx2())
+    {
+        return _string_rfind_set_avx2(data, count, set, member);
+    }
+    if (set->vector && count >= 16 && _string_has_ssse3())
+    {
+        return _string_rfind_set_ssse3(data, count, set, member);
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = count; i > 0; i--)
+    {
+        if (string_set_contains(set, data[i - 1]) == member)
+        {
+            return i - 1;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Flip the case of a byte if it is a letter of one case.
+ * @param byte Byte to fold.
+ * @param first First letter of the case to flip: `A` to lowercase, or `a` to uppercase.
+ * @returns The folded byte.
+ */
+static char _string_fold_byte(char byte, char first)
+{
+    return (unsigned char) (byte - first) < 26 ? (char) (byte ^ 0x20) : byte;
+}
+
+/**
+ * @brief Copy a range while flipping the case of the letters of one case, never reading past its end.
+ * @param source Pointer to the first byte to copy.
+ * @param destination Pointer to where the bytes are copied, which may be the source itself.
+ * @param count Number of bytes.
+ * @param first First letter of the case to flip: `A` to lowercase, or `a` to uppercase.
+ */
+static void _string_fold_case(const char *source, char *destination, size_t count, char first)
+{
+#if STRING_VIEW_SIMD
+    if (count >= 32 && _string_has_avx2())
+    {
+        _string_fold_case_avx2(source, destination, count, first);
+        return;
+    }
+    if (count >= 16)
+    {
+        _string_fold_case_sse2(source, destination, count, first);
+        return;
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = 0; i < count; i++)
+    {
+        destination[i] = _string_fold_byte(source[i], first);
+    }
+}
+
+/**
+ * @brief Constructor for a new string with a given length and data.
+ * @param data A char pointer marked with const that is directly added to the structure.
+ * @param count The provided length of the given data.
+ * @returns A new string with a given count and data.
+ */
+string_t string_new(const char *data, size_t count)
+{
+    string_t string;
+    string.count = count;
+    string.data = data;
+    return string;
+}
+
+/**
+ * @brief Allocate a new string structure from a c-string literal marked with const.
+ * @param cstr A char pointer marked with const to be passed to the `new_string` function that was previously defined.
+ * @returns A new string with data as the given cstr and the `strlen` count.
+ */
+string_t string_from_literal(const char *cstr)
+{
+    return string_new(cstr, strlen(cstr));
+}
+
+/**
+ * @brief Trim a string of its preceeding spaces. Spaces are the ASCII whitespace — space, tab, line feed, vertical tab, form feed and carriage return — whatever the locale.
+ * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @returns A copy of the same string passed into the function without its preceeding spaces.
+ */
+string_t string_trim_left(const string_t *string)
+{
+    // Most strings do not start with a space, so they are returned before any block is classified.
+    if (string->count == 0 || !string_set_contains(&_string_spaces, string->data[0]))
+    {
+        return *string;
+    }
+    const size_t i = _string_find_set(string->data, string->count, &_string_spaces, false);
+    return i == STRING_NOT_FOUND ? string_new(string->data + string->count, 0) : string_new(string->data + i, string->count - i);
+}
+
+/**
+ * @brief Trim a string of its following spaces. Spaces are the ASCII whitespace — space, tab, line feed, vertical tab, form feed and carriage return — whatever the locale.
+ * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @returns A copy of the same string passed into the function without its following spaces.
+ */
+string_t string_trim_right(const string_t *string)
+{
+    if (string->count == 0 || !string_set_contains(&_string_spaces, string->data[string->count - 1]))
+    {
+        return *string;
+    }
+    const size_t i = _string_rfind_set(string->data, string->count, &_string_spaces, false);
+    return string_new(string->data, i == STRING_NOT_FOUND ? 0 : i + 1);
+}
+
+/**
+ * @brief Trim a string of both its preceeding and following spaces. This function is a combination of both the `string_trim_left` and the `string_trim_right` functions. This function is similar to the default behaviour of Python's `string.strip()` function.
+ * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @returns A copy of the same string passed into the function without its preceeding or following spaces.
+ */
+string_t string_trim(const string_t *string)
+{
+    string_t left_trim = string_trim_left(string);
+    return string_trim_right(&left_trim);
+}
+
+/**
+ * @brief Copy a given string into a given destination with its ASCII letters in lowercase. Other bytes are copied unchanged.
+ * @param string A pointer to the string to copy.
+ * @param destination A pointer to at least `count` bytes to which to copy. It may be the data of the string itself.
+ */
+void string_copy_lower(const string_t *string, char *destination)
+{
+    _string_fold_case(string->data, destination, string->count, 'A');
+}
+
+/**
+ * @brief Copy a given string into a given destination with its ASCII letters in uppercase. Other bytes are copied unchanged.
+ * @param string A pointer to the string to copy.
+ * @param destination A pointer to at least `count` bytes to which to copy. It may be the data of the string itself.
+ */
+void string_copy_upper(const string_t *string, char *destination)
+{
+    _string_fold_case(string->data, destination, string->count, 'a');
+}
+
+/**
+ * @brief Chop a string by a given delimetre.
+ * @param string A pointer to the string that needs to be trimmed. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @param delimetre A charactor by which to split the string.
+ * @returns A string where the data is set to the first chunk of string before the given delimetre.
+ */
+string_t string_chop_by_delimetre(string_t *string, char delimetre)
+{
+    size_t i = _string_find_byte(string->data, string->count, delimetre);
+    if (i == STRING_NOT_FOUND)
+    {
+        i = string->count;
+    }
+    string_t result = string_new(string->data, i);
+    if (i < string->count)
+    {
+        string->count -= i + 1;
+        string->data += i + 1;
+    }
+    else
+    {
+        string->count -= i;
+        string->data += i;
+    }
+    return result;
+}
+
+/**
+ * @brief Construct a new set from the bytes of a given string.
+ * @param bytes String whose every byte is a member of the set.
+ * @returns A new set of the given bytes.
+ */
+string_set_t string_set_new(string_t bytes)
+{
+    string_set_t set;
+    memset(&set, 0, sizeof(set));
+    // For every high half of a byte, the low halves that complete a member.
+    uint16_t lows[16] = {0};
+    for (size_t i = 0; i < bytes.count; i++)
+    {
+        const uint8_t byte = (uint8_t) bytes.data[i];
+        set.bitmap[byte >> 3] |= (uint8_t) (1u << (byte & 7));
+        lows[byte >> 4] |= (uint16_t) (1u << (byte & 15));
+    }
+    // High halves sharing the same low halves share a bucket; each bucket is one bit of the tables, so at most 8 buckets fit.
+    uint16_t buckets[8] = {0};
+    size_t bucket_count = 0;
+    set.vector = true;
+    for (size_t high = 0; high < 16 && set.vector; high++)
+    {
+        if (lows[high] == 0)
+        {
+            continue;
+        }
+        size_t bucket = 0;
+        while (bucket < bucket_count && buckets[bucket] != lows[high])
+        {
+            bucket++;
+        }
+        if (bucket == bucket_count)
+        {
+            if (bucket_count == 8)
+            {
+                set.vector = false;
+                break;
+            }
+            buckets[bucket_count++] = lows[high];
+        }
+        set.high[high] |= (uint8_t) (1u << bucket);
+        for (size_t low = 0; low < 16; low++)
+        {
+            if (lows[high] & (1u << low))
+            {
+                set.low[low] |= (uint8_t) (1u << bucket);
+            }
+        }
+    }
+    return set;
+}
+
+/**
+ * @brief Determine whether a given charactor is a member of a given set.
+ * @param set A pointer to the set.
+ * @param charactor The charactor to look up.
+ * @returns A boolean on whether the charactor is a member of the set.
+ */
+bool string_set_contains(const string_set_t *set, char_t charactor)
+{
+    const uint8_t byte = (uint8_t) charactor;
+    return (set->bitmap[byte >> 3] >> (byte & 7)) & 1;
+}
+
+/**
+ * @brief Find the first charactor of a given string that is a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to find.
+ * @returns The index of the first charactor within the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_first_of_any(const string_t *string, const string_set_t *set)
+{
+    return _string_find_set(string->data, string->count, set, true);
+}
+
+/**
+ * @brief Find the last charactor of a given string that is a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to find.
+ * @returns The index of the last charactor within the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_last_of_any(const string_t *string, const string_set_t *set)
+{
+    return _string_rfind_set(string->data, string->count, set, true);
+}
+
+/**
+ * @brief Find the first charactor of a given string that is not a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to skip.
+ * @returns The index of the first charactor outside of the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_first_not_of_any(const string_t *string, const string_set_t *set)
+{
+    return _string_find_set(string->data, string->count, set, false);
+}
+
+/**
+ * @brief Find the last charactor of a given string that is not a member of a given set.
+ * @param string A pointer to the string to search.
+ * @param set A pointer to the set of charactors to skip.
+ * @returns The index of the last charactor outside of the set, or `STRING_NOT_FOUND` if there is none.
+ */
+size_t string_find_last_not_of_any(const string_t *string, const string_set_t *set)
+{
+    return _string_rfind_set(string->data, string->count, set, false);
+}
+
+/**
+ * @brief Determine whether every charactor of a given string is a member of a given set, such as whether a field consists of only digits.
+ * @param string A pointer to the string to check.
+ * @param set A pointer to the set of allowed charactors.
+ * @returns A boolean on whether every charactor is within the set. An empty string is always within the set.
+ */
+bool string_is_all_of(const string_t *string, const string_set_t *set)
+{
+    return _string_find_set(string->data, string->count, set, false) == STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Chop a string by the first of any of a set of delimetres.
+ * @param string A pointer to the string that needs to be chopped. The chopped chunk and its delimetre are removed from the front of the string.
+ * @param delimetres A pointer to the set of charactors by which to split the string.
+ * @returns A string where the data is set to the first chunk of string before any of the given delimetres.
+ */
+string_t string_chop_by_any(string_t *string, const string_set_t *delimetres)
+{
+    size_t i = string_find_first_of_any(string, delimetres);
+    if (i == STRING_NOT_FOUND)
+    {
+        i = string->count;
+    }
+    string_t result = string_new(string->data, i);
+    const size_t skip = i < string->count ? i + 1 : i;
+    string->count -= skip;
+    string->data += skip;
+    return result;
+}
+
+/**
+ * @brief Construct a new iterator over the tokens of a string split by a set of delimetres.
+ * @param string String to split. The string is not copied, so it must outlive the iterator.
+ * @param delimetres A pointer to the set of charactors by which to split the string. The set must outlive the iterator.
+ * @returns A new split iterator.
+ */
+string_split_t string_split_new(string_t string, const string_set_t *delimetres)
+{
+    string_split_t split;
+    split.rest = string;
+    split.delimetres = delimetres;
+    split.done = false;
+    return split;
+}
+
+/**
+ * @brief Obtain the next token of a split string. Consecutive delimetres produce empty tokens, and a string with `n` delimetres always produces `n + 1` tokens.
+ * @param split A pointer to the split iterator.
+ * @param token A pointer to which to write the token.
+ * @returns True if a token was written, else false once every token has been produced.
+ */
+bool string_split_next(string_split_t *split, string_t *token)
+{
+    if (split->done)
+    {
+        return false;
+    }
+    const size_t i = string_find_first_of_any(&split->rest, split->delimetres);
+    if (i == STRING_NOT_FOUND)
+    {
+        *token = split->rest;
+        split->rest = string_new(split->rest.data + split->rest.count, 0);
+        split->done = true;
+        return true;
+    }
+    *token = string_new(split->rest.data, i);
+    split->rest = string_new(split->rest.data + i + 1, split->rest.count - i - 1);
+    return true;
+}
+
+/**
+ * @brief Chop the next line from the front of a string. A line ends at a line feed, which is removed from the string with it, and a carriage return before the line feed is left out of the line, so both `\n` and `\r\n` endings are handled. The last line does not need to end with a line feed. Lines are views into the string, so nothing is copied.
+ * @param rest A pointer to the string from which to chop the line.
+ * @param line A pointer to which to write the line.
+ * @returns True if a line was written, else false once the string is empty.
+ */
+bool string_next_line(string_t *rest, string_t *line)
+{
+    if (rest->count == 0)
+    {
+        return false;
+    }
+    size_t i = _string_find_byte(rest->data, rest->count, '\n');
+    const size_t skip = i == STRING_NOT_FOUND ? rest->count : i + 1;
+    if (i == STRING_NOT_FOUND)
+    {
+        i = rest->count;
+    }
+    if (i > 0 && rest->data[i - 1] == '\r')
+    {
+        i--;
+    }
+    *line = string_new(rest->data, i);
+    rest->data += skip;
+    rest->count -= skip;
+    return true;
+}
+
+/**
+ * @brief Find the first occurance of a given charactor within a given string. Only the first `count` bytes are searched, so the string does not need to be null terminated.
+ * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @param charactor The charactor to find within the given string.
+ * @returns The index of the first occurance of the given charactor within the given string, or `STRING_NOT_FOUND` if the charactor is not found.
+ */
+size_t string_find_first_of(const string_t *string, char_t charactor)
+{
+    return _string_find_byte(string->data, string->count, (char) charactor);
+}
+
+/**
+ * @brief Find the last occurance of a given charactor within a given string. Only the first `count` bytes are searched, so the string does not need to be null terminated.
+ * @param string A pointer to the string that contains the given charactor. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @param charactor The charactor to find within the given string.
+ * @returns The index of the last occurance of the given charactor within the given string, or `STRING_NOT_FOUND` if the charactor is not found.
+ */
+size_t string_find_last_of(const string_t *string, char_t charactor)
+{
+    return _string_rfind_byte(string->data, string->count, (char) charactor);
+}
+
+/**
+ * @brief Determine whether a given string starts with a given expected string.
+ * @param string A pointer to the string that contains the given string. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @param expected The expected prefix to check against.
+ * @returns A boolean on whether `string` starts with `expected`.
+ */
+bool string_starts_with(const string_t *string, string_t expected)
+{
+    if (expected.count > string->count)
+    {
+        return false;
+    }
+    string_t actual = string_new(string->data, expected.count);
+    return string_equals(expected, actual);
+}
+
+/**
+ * @brief Determine whether a given string ends with a given expected string.
+ * @param string A pointer to the string that contains the given string. It is passed by pointer because it is mutable — or changeable — and shouldn't be localized or passed by value.
+ * @param expected The expected suffix to check against.
+ * @returns A boolean on whether `string` ends with `expected`.
+ */
+bool string_ends_with(const string_t *string, string_t expected)
+{
+    if (expected.count > string->count)
+    {
+        return false;
+    }
+    string_t actual = string_new(string->data + string->count - expected.count, expected.count);
+    return string_equals(expected, actual);
+}
+
+/**
+ * @brief Number of bytes the substring filter may compare for free before the search falls back to the Two-Way algorithm; past it, one byte is allowed for every byte scanned, so the filter never does more than linear work.
+ */
+#define _STRING_FIND_BUDGET 1024
+
+/**
+ * @brief Compare a candidate against the needle a block at a time, charging the work with the bytes of every block compared, so that a candidate failing late costs as much as it took.
+ * @param data Pointer to the first byte of the candidate.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes to compare.
+ * @param work Number of bytes compared so far, which is increased.
+ * @returns True if the candidate is determined to match, else false.
+ */
+static inline bool _string_verify(const char *data, const char *needle, size_t length, size_t *work)
+{
+    size_t offset = 0;
+    while (offset < length)
+    {
+        const size_t block = length - offset < 32 ? length - offset : 32;
+        *work += block;
+        if (memcmp(data + offset, needle + offset, block) != 0)
+        {
+            return false;
+        }
+        offset += block;
+    }
+    return true;
+}
+
+#if STRING_VIEW_SIMD
+/**
+ * @brief Search for a needle of at least two bytes 16 positions at a time. A position is only verified if both the first and the last byte of the needle match there.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the first position not yet searched if the filter gives up because failed candidates cost too much.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_find_filter_sse2(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[length - 1]);
+    size_t work = 0;
+    size_t i = 0;
+    for (; i + length - 1 + 16 <= count; i += 16)
+    {
+        const __m128i starts = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + i)), first);
+        const __m128i ends = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + i + length - 1)), last);
+        unsigned int mask = (unsigned int) _mm_movemask_epi8(_mm_and_si128(starts, ends));
+        while (mask)
+        {
+            const size_t position = i + (size_t) __builtin_ctz(mask);
+            if (_string_verify(data + position + 1, needle + 1, length - 2, &work))
+            {
+                return position;
+            }
+            if (++work > _STRING_FIND_BUDGET + position)
+            {
+                *resume = position + 1;
+                return STRING_NOT_FOUND;
+            }
+            mask &= mask - 1;
+        }
+    }
+    for (; i + length <= count; i++)
+    {
+        if (data[i] == needle[0] && memcmp(data + i + 1, needle + 1, length - 1) == 0)
+        {
+            return i;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Search backwards for a needle of at least two bytes 16 positions at a time.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the number of positions not yet searched, all at the start of the haystack, if the filter gives up.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_rfind_filter_sse2(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[length - 1]);
+    size_t work = 0;
+    size_t end = count - length + 1;
+    for (; end >= 16; end -= 16)
+    {
+        const size_t start = end - 16;
+        const __m128i starts = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + start)), first);
+        const __m128i ends = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (data + start + length - 1)), last);
+        unsigned int mask = (unsigned int) _mm_movemask_epi8(_mm_and_si128(starts, ends));
+        while (mask)
+        {
+            const unsigned int bit = 31u - (unsigned int) __builtin_clz(mask);
+            const size_t position = start + bit;
+            if (_string_verify(data + position + 1, needle + 1, length - 2, &work))
+            {
+                return position;
+            }
+            if (++work > _STRING_FIND_BUDGET + (count - position))
+            {
+                *resume = position;
+                return STRING_NOT_FOUND;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    for (; end > 0; end--)
+    {
+        if (data[end - 1] == needle[0] && memcmp(data + end, needle + 1, length - 1) == 0)
+        {
+            return end - 1;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Search for a needle of at least two bytes 32 positions at a time. A position is only verified if both the first and the last byte of the needle match there.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the first position not yet searched if the filter gives up because failed candidates cost too much.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
+ */
+__attribute__((target("avx2")))
+static size_t _string_find_filter_avx2(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[length - 1]);
+    size_t work = 0;
+    size_t i = 0;
+    for (; i + length - 1 + 32 <= count; i += 32)
+    {
+        const __m256i starts = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + i)), first);
+        const __m256i ends = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + i + length - 1)), last);
+        unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(starts, ends));
+        while (mask)
+        {
+            const size_t position = i + (size_t) __builtin_ctz(mask);
+            if (_string_verify(data + position + 1, needle + 1, length - 2, &work))
+            {
+                return position;
+            }
+            if (++work > _STRING_FIND_BUDGET + position)
+            {
+                *resume = position + 1;
+                return STRING_NOT_FOUND;
+            }
+            mask &= mask - 1;
+        }
+    }
+    for (; i + length <= count; i++)
+    {
+        if (data[i] == needle[0] && memcmp(data + i + 1, needle + 1, length - 1) == 0)
+        {
+            return i;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Search backwards for a needle of at least two bytes 32 positions at a time.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the number of positions not yet searched, all at the start of the haystack, if the filter gives up.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
+ */
+__attribute__((target("avx2")))
+static size_t _string_rfind_filter_avx2(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[length - 1]);
+    size_t work = 0;
+    size_t end = count - length + 1;
+    for (; end >= 32; end -= 32)
+    {
+        const size_t start = end - 32;
+        const __m256i starts = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + start)), first);
+        const __m256i ends = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *) (data + start + length - 1)), last);
+        unsigned int mask = (unsigned int) _mm256_movemask_epi8(_mm256_and_si256(starts, ends));
+        while (mask)
+        {
+            const unsigned int bit = 31u - (unsigned int) __builtin_clz(mask);
+            const size_t position = start + bit;
+            if (_string_verify(data + position + 1, needle + 1, length - 2, &work))
+            {
+                return position;
+            }
+            if (++work > _STRING_FIND_BUDGET + (count - position))
+            {
+                *resume = position;
+                return STRING_NOT_FOUND;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    for (; end > 0; end--)
+    {
+        if (data[end - 1] == needle[0] && memcmp(data + end, needle + 1, length - 1) == 0)
+        {
+            return end - 1;
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+#else
+/**
+ * @brief Search for a needle of at least two bytes, skipping to every occurance of its first byte. A position is only verified if the last byte of the needle also matches there.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the first position not yet searched if the filter gives up because failed candidates cost too much.
+ * @returns The index of the first occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_find_filter_scalar(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    size_t work = 0;
+    size_t position = 0;
+    while (position + length <= count)
+    {
+        const size_t offset = _string_find_byte(data + position, count - length + 1 - position, needle[0]);
+        if (offset == STRING_NOT_FOUND)
+        {
+            return STRING_NOT_FOUND;
+        }
+        position += offset;
+        if (data[position + length - 1] == needle[length - 1] && _string_verify(data + position + 1, needle + 1, length - 2, &work))
+        {
+            return position;
+        }
+        if (++work > _STRING_FIND_BUDGET + position)
+        {
+            *resume = position + 1;
+            return STRING_NOT_FOUND;
+        }
+        position++;
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Search backwards for a needle of at least two bytes, skipping to every occurance of its first byte.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param resume Set to the number of positions not yet searched, all at the start of the haystack, if the filter gives up.
+ * @returns The index of the last occurance, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_rfind_filter_scalar(const char *data, size_t count, const char *needle, size_t length, size_t *resume)
+{
+    size_t work = 0;
+    size_t positions = count - length + 1;
+    while (positions > 0)
+    {
+        const size_t position = _string_rfind_byte(data, positions, needle[0]);
+        if (position == STRING_NOT_FOUND)
+        {
+            return STRING_NOT_FOUND;
+        }
+        if (data[position + length - 1] == needle[length - 1] && _string_verify(data + position + 1, needle + 1, length - 2, &work))
+        {
+            return position;
+        }
+        if (++work > _STRING_FIND_BUDGET + (count - position))
+        {
+            *resume = position;
+            return STRING_NOT_FOUND;
+        }
+        positions = position;
+    }
+    return STRING_NOT_FOUND;
+}
+#endif // STRING_VIEW_SIMD
+
+/**
+ * @brief Obtain a byte of a range, counting either from its start or from its end.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes.
+ * @param index Index of the byte.
+ * @param reverse Whether to count from the end.
+ * @returns The byte.
+ */
+static inline char _string_at(const char *data, size_t count, size_t index, bool reverse)
+{
+    return reverse ? data[count - 1 - index] : data[index];
+}
+
+/**
+ * @brief Split a needle at its critical factorisation, as required by the Two-Way algorithm, by computing its maximal suffix under both orderings of the bytes.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle.
+ * @param reverse Whether the needle is read backwards.
+ * @param period Set to the period of the right half of the factorisation.
+ * @returns The length of the left half of the factorisation.
+ */
+static size_t _string_critical_factorisation(const char *needle, size_t length, bool reverse, size_t *period)
+{
+    // Indices start below zero, relying on the wrap-around of unsigned arithmetic.
+    size_t suffixes[2];
+    size_t periods[2];
+    for (int order = 0; order < 2; order++)
+    {
+        size_t suffix = SIZE_MAX;
+        size_t j = 0;
+        size_t k = 1;
+        size_t p = 1;
+        while (j + k < length)
+        {
+            const unsigned char a = (unsigned char) _string_at(needle, length, j + k, reverse);
+            const unsigned char b = (unsigned char) _string_at(needle, length, suffix + k, reverse);
+            if (order == 0 ? a < b : a > b)
+            {
+                j += k;
+                k = 1;
+                p = j - suffix;
+            }
+            else if (a == b)
+            {
+                if (k != p)
+                {
+                    k++;
+                }
+                else
+                {
+                    j += p;
+                    k = 1;
+                }
+            }
+            else
+            {
+                suffix = j++;
+                k = p = 1;
+            }
+        }
+        suffixes[order] = suffix;
+        periods[order] = p;
+    }
+    const int order = suffixes[1] + 1 < suffixes[0] + 1 ? 0 : 1;
+    *period = periods[order];
+    return suffixes[order] + 1;
+}
+
+/**
+ * @brief Find the first occurance of a needle with the Two-Way algorithm, which takes linear time and constant space. Reading both ranges backwards finds the last occurance instead.
+ * @param data Pointer to the first byte of the haystack.
+ * @param count Number of bytes within the haystack.
+ * @param needle Pointer to the first byte of the needle.
+ * @param length Number of bytes within the needle, which must not be greater than the haystack.
+ * @param reverse Whether both ranges are read backwards.
+ * @returns The position of the occurance counted in the direction of the search, or `STRING_NOT_FOUND`.
+ */
+static size_t _string_two_way(const char *data, size_t count, const char *needle, size_t length, bool reverse)
+{
+    size_t period;
+    const size_t suffix = _string_critical_factorisation(needle, length, reverse, &period);
+    bool periodic = true;
+    for (size_t i = 0; i < suffix && periodic; i++)
+    {
+        periodic = period + i < length && _string_at(needle, length, i, reverse) == _string_at(needle, length, period + i, reverse);
+    }
+    size_t j = 0;
+    if (periodic)
+    {
+        // The left half repeats with the period, so the part of the needle already matched after a shift is remembered.
+        size_t memory = 0;
+        while (j <= count - length)
+        {
+            size_t i = suffix > memory ? suffix : memory;
+            while (i < length && _string_at(needle, length, i, reverse) == _string_at(data, count, i + j, reverse))
+            {
+                i++;
+            }
+            if (i >= length)
+            {
+                i = suffix - 1;
+                while (memory < i + 1 && _string_at(needle, length, i, reverse) == _string_at(data, count, i + j, reverse))
+                {
+                    i--;
+                }
+                if (i + 1 < memory + 1)
+                {
+                    return j;
+                }
+                j += period;
+                memory = length - period;
+            }
+            else
+            {
+                j += i - suffix + 1;
+                memory = 0;
+            }
+        }
+    }
+    else
+    {
+        period = (suffix > length - suffix ? suffix : length - suffix) + 1;
+        while (j <= count - length)
+        {
+            size_t i = suffix;
+            while (i < length && _string_at(needle, length, i, reverse) == _string_at(data, count, i + j, reverse))
+            {
+                i++;
+            }
+            if (i >= length)
+            {
+                i = suffix - 1;
+                while (i != SIZE_MAX && _string_at(needle, length, i, reverse) == _string_at(data, count, i + j, reverse))
+                {
+                    i--;
+                }
+                if (i == SIZE_MAX)
+                {
+                    return j;
+                }
+                j += period;
+            }
+            else
+            {
+                j += i - suffix + 1;
+            }
+        }
+    }
+    return STRING_NOT_FOUND;
+}
+
+/**
+ * @brief Find the first occurance of a given needle within a given haystack. Runs in linear time in the worst case.
+ * @param haystack A pointer to the string to search.
+ * @param needle The string to find.
+ * @returns The index at which the first occurance of the needle starts, `0` if the needle is empty, or `STRING_NOT_FOUND` if the needle is not found.
+ */
+size_t string_find(const string_t *haystack, string_t needle)
+{
+    const char *data = haystack->data;
+    const size_t count = haystack->count;
+    if (needle.count == 0)
+    {
+        return 0;
+    }
+    if (needle.count > count)
+    {
+        return STRING_NOT_FOUND;
+    }
+    if (needle.count == 1)
+    {
+        return _string_find_byte(data, count, needle.data[0]);
+    }
+    // The filter verifies every position whose first and last bytes match; if too many of them fail, the rest is left to the Two-Way algorithm.
+    size_t resume = SIZE_MAX;
+#if STRING_VIEW_SIMD
+    const size_t index = _string_has_avx2()
+        ? _string_find_filter_avx2(data, count, needle.data, needle.count, &resume)
+        : _string_find_filter_sse2(data, count, needle.data, needle.count, &resume);
+#else
+    const size_t index = _string_find_filter_scalar(data, count, needle.data, needle.count, &resume);
+#endif // STRING_VIEW_SIMD
+    if (index != STRING_NOT_FOUND || resume == SIZE_MAX || count - resume < needle.count)
+    {
+        return index;
+    }
+    const size_t rest = _string_two_way(data + resume, count - resume, needle.data, needle.count, false);
+    return rest == STRING_NOT_FOUND ? rest : resume + rest;
+}
+
+/**
+ * @brief Find the last occurance of a given needle within a given haystack. Runs in linear time in the worst case.
+ * @param haystack A pointer to the string to search.
+ * @param needle The string to find.
+ * @returns The index at which the last occurance of the needle starts, the count of the haystack if the needle is empty, or `STRING_NOT_FOUND` if the needle is not found.
+ */
+size_t string_rfind(const string_t *haystack, string_t needle)
+{
+    const char *data = haystack->data;
+    const size_t count = haystack->count;
+    if (needle.count == 0)
+    {
+        return count;
+    }
+    if (needle.count > count)
+    {
+        return STRING_NOT_FOUND;
+    }
+    if (needle.count == 1)
+    {
+        return _string_rfind_byte(data, count, needle.data[0]);
+    }
+    // Positions are searched from the last one down; if the filter gives up, `positions` is the number of them left at the start.
+    size_t positions = SIZE_MAX;
+#if STRING_VIEW_SIMD
+    const size_t index = _string_has_avx2()
+        ? _string_rfind_filter_avx2(data, count, needle.data, needle.count, &positions)
+        : _string_rfind_filter_sse2(data, count, needle.data, needle.count, &positions);
+#else
+    const size_t index = _string_rfind_filter_scalar(data, count, needle.data, needle.count, &positions);
+#endif // STRING_VIEW_SIMD
+    if (index != STRING_NOT_FOUND || positions == SIZE_MAX || positions == 0)
+    {
+        return index;
+    }
+    const size_t span = positions + needle.count - 1;
+    const size_t rest = _string_two_way(data, span, needle.data, needle.count, true);
+    return rest == STRING_NOT_FOUND ? rest : span - needle.count - rest;
+}
+
+/**
+ * @brief Powers of ten that a double represents exactly, for the fast path of `string_to_f64`.
+ */
+static const double _string_exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Smallest power of ten for which a non-zero mantissa of at most 19 digits may still round to a non-zero double.
+ */
+#define _STRING_SMALLEST_POWER -342
+
+/**
+ * @brief Largest power of ten for which a mantissa of at least one may still round to a finite double.
+ */
+#define _STRING_LARGEST_POWER 308
+
+/**
+ * @brief The 128 most significant bits of each power of five from `5^-342` to `5^308`, as pairs of the high and the low 64 bits. The negative powers are rounded up.
+ */
+static const uint64_t _string_powers_of_five[] = {
+    0xeef453d6923bd65au, 0x113faa2906a13b3fu,
+    0x9558b4661b6565f8u, 0x4ac7ca59a424c507u,
+    0xbaaee17fa23ebf76u, 0x5d79bcf00d2df649u,
+    0xe95a99df8ace6f53u, 0xf4d82c2c107973dcu,
+    0x91d8a02bb6c10594u, 0x79071b9b8a4be869u,
+    0xb64ec836a47146f9u, 0x9748e2826cdee284u,
+    0xe3e27a444d8d98b7u, 0xfd1b1b2308169b25u,
+    0x8e6d8c6ab0787f72u, 0xfe30f0f5e50e20f7u,
+    0xb208ef855c969f4fu, 0xbdbd2d335e51a935u,
+    0xde8b2b66b3bc4723u, 0xad2c788035e61382u,
+    0x8b16fb203055ac76u, 0x4c3bcb5021afcc31u,
+    0xaddcb9e83c6b1793u, 0xdf4abe242a1bbf3du,
+    0xd953e8624b85dd78u, 0xd71d6dad34a2af0du,
+    0x87d4713d6f33aa6bu, 0x8672648c40e5ad68u,
+    0xa9c98d8ccb009506u, 0x680efdaf511f18c2u,
+    0xd43bf0effdc0ba48u, 0x0212bd1b2566def2u,
+    0x84a57695fe98746du, 0x014bb630f7604b57u,
+    0xa5ced43b7e3e9188u, 0x419ea3bd35385e2du,
+    0xcf42894a5dce35eau, 0x52064cac828675b9u,
+    0x818995ce7aa0e1b2u, 0x7343efebd1940993u,
+    0xa1ebfb4219491a1fu, 0x1014ebe6c5f90bf8u,
+    0xca66fa129f9b60a6u, 0xd41a26e077774ef6u,
+    0xfd00b897478238d0u, 0x8920b098955522b4u,
+    0x9e20735e8cb16382u, 0x55b46e5f5d5535b0u,
+    0xc5a890362fddbc62u, 0xeb2189f734aa831du,
+    0xf712b443bbd52b7bu, 0xa5e9ec7501d523e4u,
+    0x9a6bb0aa55653b2du, 0x47b233c92125366eu,
+    0xc1069cd4eabe89f8u, 0x999ec0bb696e840au,
+    0xf148440a256e2c76u, 0xc00670ea43ca250du,
+    0x96cd2a865764dbcau, 0x380406926a5e5728u,
+    0xbc807527ed3e12bcu, 0xc605083704f5ecf2u,
+    0xeba09271e88d976bu, 0xf7864a44c633682eu,
+    0x93445b8731587ea3u, 0x7ab3ee6afbe0211du,
+    0xb8157268fdae9e4cu, 0x5960ea05bad82964u,
+    0xe61acf033d1a45dfu, 0x6fb92487298e33bdu,
+    0x8fd0c16206306babu, 0xa5d3b6d479f8e056u,
+    0xb3c4f1ba87bc8696u, 0x8f48a4899877186cu,
+    0xe0b62e2929aba83cu, 0x331acdabfe94de87u,
+    0x8c71dcd9ba0b4925u, 0x9ff0c08b7f1d0b14u,
+    0xaf8e5410288e1b6fu, 0x07ecf0ae5ee44dd9u,
+    0xdb71e91432b1a24au, 0xc9e82cd9f69d6150u,
+    0x892731ac9faf056eu, 0xbe311c083a225cd2u,
+    0xab70fe17c79ac6cau, 0x6dbd630a48aaf406u,
+    0xd64d3d9db981787du, 0x092cbbccdad5b108u,
+    0x85f0468293f0eb4eu, 0x25bbf56008c58ea5u,
+    0xa76c582338ed2621u, 0xaf2af2b80af6f24eu,
+    0xd1476e2c07286faau, 0x1af5af660db4aee1u,
+    0x82cca4db847945cau, 0x50d98d9fc890ed4du,
+    0xa37fce126597973cu, 0xe50ff107bab528a0u,
+    0xcc5fc196fefd7d0cu, 0x1e53ed49a96272c8u,
+    0xff77b1fcbebcdc4fu, 0x25e8e89c13bb0f7au,
+    0x9faacf3df73609b1u, 0x77b191618c54e9acu,
+    0xc795830d75038c1du, 0xd59df5b9ef6a2417u,
+    0xf97ae3d0d2446f25u, 0x4b0573286b44ad1du,
+    0x9becce62836ac577u, 0x4ee367f9430aec32u,
+    0xc2e801fb244576d5u, 0x229c41f793cda73fu,
+    0xf3a20279ed56d48au, 0x6b43527578c1110fu,
+    0x9845418c345644d6u, 0x830a13896b78aaa9u,
+    0xbe5691ef416bd60cu, 0x23cc986bc656d553u,
+    0xedec366b11c6cb8fu, 0x2cbfbe86b7ec8aa8u,
+    0x94b3a202eb1c3f39u, 0x7bf7d71432f3d6a9u,
+    0xb9e08a83a5e34f07u, 0xdaf5ccd93fb0cc53u,
+    0xe858ad248f5c22c9u, 0xd1b3400f8f9cff68u,
+    0x91376c36d99995beu, 0x23100809b9c21fa1u,
+    0xb58547448ffffb2du, 0xabd40a0c2832a78au,
+    0xe2e69915b3fff9f9u, 0x16c90c8f323f516cu,
+    0x8dd01fad907ffc3bu, 0xae3da7d97f6792e3u,
+    0xb1442798f49ffb4au, 0x99cd11cfdf41779cu,
+    0xdd95317f31c7fa1du, 0x40405643d711d583u,
+    0x8a7d3eef7f1cfc52u, 0x482835ea666b2572u,
+    0xad1c8eab5ee43b66u, 0xda3243650005eecfu,
+    0xd863b256369d4a40u, 0x90bed43e40076a82u,
+    0x873e4f75e2224e68u, 0x5a7744a6e804a291u,
+    0xa90de3535aaae202u, 0x711515d0a205cb36u,
+    0xd3515c2831559a83u, 0x0d5a5b44ca873e03u,
+    0x8412d9991ed58091u, 0xe858790afe9486c2u,
+    0xa5178fff668ae0b6u, 0x626e974dbe39a872u,
+    0xce5d73ff402d98e3u, 0xfb0a3d212dc8128fu,
+    0x80fa687f881c7f8eu, 0x7ce66634bc9d0b99u,
+    0xa139029f6a239f72u, 0x1c1fffc1ebc44e80u,
+    0xc987434744ac874eu, 0xa327ffb266b56220u,
+    0xfbe9141915d7a922u, 0x4bf1ff9f0062baa8u,
+    0x9d71ac8fada6c9b5u, 0x6f773fc3603db4a9u,
+    0xc4ce17b399107c22u, 0xcb550fb4384d21d3u,
+    0xf6019da07f549b2bu, 0x7e2a53a146606a48u,
+    0x99c102844f94e0fbu, 0x2eda7444cbfc426du,
+    0xc0314325637a1939u, 0xfa911155fefb5308u,
+    0xf03d93eebc589f88u, 0x793555ab7eba27cau,
+    0x96267c7535b763b5u, 0x4bc1558b2f3458deu,
+    0xbbb01b9283253ca2u, 0x9eb1aaedfb016f16u,
+    0xea9c227723ee8bcbu, 0x465e15a979c1cadcu,
+    0x92a1958a7675175fu, 0x0bfacd89ec191ec9u,
+    0xb749faed14125d36u, 0xcef980ec671f667bu,
+    0xe51c79a85916f484u, 0x82b7e12780e7401au,
+    0x8f31cc0937ae58d2u, 0xd1b2ecb8b0908810u,
+    0xb2fe3f0b8599ef07u, 0x861fa7e6dcb4aa15u,
+    0xdfbdcece67006ac9u, 0x67a791e093e1d49au,
+    0x8bd6a141006042bdu, 0xe0c8bb2c5c6d24e0u,
+    0xaecc49914078536du, 0x58fae9f773886e18u,
+    0xda7f5bf590966848u, 0xaf39a475506a899eu,
+    0x888f99797a5e012du, 0x6d8406c952429603u,
+    0xaab37fd7d8f58178u, 0xc8e5087ba6d33b83u,
+    0xd5605fcdcf32e1d6u, 0xfb1e4a9a90880a64u,
+    0x855c3be0a17fcd26u, 0x5cf2eea09a55067fu,
+    0xa6b34ad8c9dfc06fu, 0xf42faa48c0ea481eu,
+    0xd0601d8efc57b08bu, 0xf13b94daf124da26u,
+    0x823c12795db6ce57u, 0x76c53d08d6b70858u,
+    0xa2cb1717b52481edu, 0x54768c4b0c64ca6eu,
+    0xcb7ddcdda26da268u, 0xa9942f5dcf7dfd09u,
+    0xfe5d54150b090b02u, 0xd3f93b35435d7c4cu,
+    0x9efa548d26e5a6e1u, 0xc47bc5014a1a6dafu,
+    0xc6b8e9b0709f109au, 0x359ab6419ca1091bu,
+    0xf867241c8cc6d4c0u, 0xc30163d203c94b62u,
+    0x9b407691d7fc44f8u, 0x79e0de63425dcf1du,
+    0xc21094364dfb5636u, 0x985915fc12f542e4u,
+    0xf294b943e17a2bc4u, 0x3e6f5b7b17b2939du,
+    0x979cf3ca6cec5b5au, 0xa705992ceecf9c42u,
+    0xbd8430bd08277231u, 0x50c6ff782a838353u,
+    0xece53cec4a314ebdu, 0xa4f8bf5635246428u,
+    0x940f4613ae5ed136u, 0x871b7795e136be99u,
+    0xb913179899f68584u, 0x28e2557b59846e3fu,
+    0xe757dd7ec07426e5u, 0x331aeada2fe589cfu,
+    0x9096ea6f3848984fu, 0x3ff0d2c85def7621u,
+    0xb4bca50b065abe63u, 0x0fed077a756b53a9u,
+    0xe1ebce4dc7f16dfbu, 0xd3e8495912c62894u,
+    0x8d3360f09cf6e4bdu, 0x64712dd7abbbd95cu,
+    0xb080392cc4349decu, 0xbd8d794d96aacfb3u,
+    0xdca04777f541c567u, 0xecf0d7a0fc5583a0u,
+    0x89e42caaf9491b60u, 0xf41686c49db57244u,
+    0xac5d37d5b79b6239u, 0x311c2875c522ced5u,
+    0xd77485cb25823ac7u, 0x7d633293366b828bu,
+    0x86a8d39ef77164bcu, 0xae5dff9c02033197u,
+    0xa8530886b54dbdebu, 0xd9f57f830283fdfcu,
+    0xd267caa862a12d66u, 0xd072df63c324fd7bu,
+    0x8380dea93da4bc60u, 0x4247cb9e59f71e6du,
+    0xa46116538d0deb78u, 0x52d9be85f074e608u,
+    0xcd795be870516656u, 0x67902e276c921f8bu,
+    0x806bd9714632dff6u, 0x00ba1cd8a3db53b6u,
+    0xa086cfcd97bf97f3u, 0x80e8a40eccd228a4u,
+    0xc8a883c0fdaf7df0u, 0x6122cd128006b2cdu,
+    0xfad2a4b13d1b5d6cu, 0x796b805720085f81u,
+    0x9cc3a6eec6311a63u, 0xcbe3303674053bb0u,
+    0xc3f490aa77bd60fcu, 0xbedbfc4411068a9cu,
+    0xf4f1b4d515acb93bu, 0xee92fb5515482d44u,
+    0x991711052d8bf3c5u, 0x751bdd152d4d1c4au,
+    0xbf5cd54678eef0b6u, 0xd262d45a78a0635du,
+    0xef340a98172aace4u, 0x86fb897116c87c34u,
+    0x9580869f0e7aac0eu, 0xd45d35e6ae3d4da0u,
+    0xbae0a846d2195712u, 0x8974836059cca109u,
+    0xe998d258869facd7u, 0x2bd1a438703fc94bu,
+    0x91ff83775423cc06u, 0x7b6306a34627ddcfu,
+    0xb67f6455292cbf08u, 0x1a3bc84c17b1d542u,
+    0xe41f3d6a7377eecau, 0x20caba5f1d9e4a93u,
+    0x8e938662882af53eu, 0x547eb47b7282ee9cu,
+    0xb23867fb2a35b28du, 0xe99e619a4f23aa43u,
+    0xdec681f9f4c31f31u, 0x6405fa00e2ec94d4u,
+    0x8b3c113c38f9f37eu, 0xde83bc408dd3dd04u,
+    0xae0b158b4738705eu, 0x9624ab50b148d445u,
+    0xd98ddaee19068c76u, 0x3badd624dd9b0957u,
+    0x87f8a8d4cfa417c9u, 0xe54ca5d70a80e5d6u,
+    0xa9f6d30a038d1dbcu, 0x5e9fcf4ccd211f4cu,
+    0xd47487cc8470652bu, 0x7647c3200069671fu,
+    0x84c8d4dfd2c63f3bu, 0x29ecd9f40041e073u,
+    0xa5fb0a17c777cf09u, 0xf468107100525890u,
+    0xcf79cc9db955c2ccu, 0x7182148d4066eeb4u,
+    0x81ac1fe293d599bfu, 0xc6f14cd848405530u,
+    0xa21727db38cb002fu, 0xb8ada00e5a506a7cu,
+    0xca9cf1d206fdc03bu, 0xa6d90811f0e4851cu,
+    0xfd442e4688bd304au, 0x908f4a166d1da663u,
+    0x9e4a9cec15763e2eu, 0x9a598e4e043287feu,
+    0xc5dd44271ad3cdbau, 0x40eff1e1853f29fdu,
+    0xf7549530e188c128u, 0xd12bee59e68ef47cu,
+    0x9a94dd3e8cf578b9u, 0x82bb74f8301958ceu,
+    0xc13a148e3032d6e7u, 0xe36a52363c1faf01u,
+    0xf18899b1bc3f8ca1u, 0xdc44e6c3cb279ac1u,
+    0x96f5600f15a7b7e5u, 0x29ab103a5ef8c0b9u,
+    0xbcb2b812db11a5deu, 0x7415d448f6b6f0e7u,
+    0xebdf661791d60f56u, 0x111b495b3464ad21u,
+    0x936b9fcebb25c995u, 0xcab10dd900beec34u,
+    0xb84687c269ef3bfbu, 0x3d5d514f40eea742u,
+    0xe65829b3046b0afau, 0x0cb4a5a3112a5112u,
+    0x8ff71a0fe2c2e6dcu, 0x47f0e785eaba72abu,
+    0xb3f4e093db73a093u, 0x59ed216765690f56u,
+    0xe0f218b8d25088b8u, 0x306869c13ec3532cu,
+    0x8c974f7383725573u, 0x1e414218c73a13fbu,
+    0xafbd2350644eeacfu, 0xe5d1929ef90898fau,
+    0xdbac6c247d62a583u, 0xdf45f746b74abf39u,
+    0x894bc396ce5da772u, 0x6b8bba8c328eb783u,
+    0xab9eb47c81f5114fu, 0x066ea92f3f326564u,
+    0xd686619ba27255a2u, 0xc80a537b0efefebdu,
+    0x8613fd0145877585u, 0xbd06742ce95f5f36u,
+    0xa798fc4196e952e7u, 0x2c48113823b73704u,
+    0xd17f3b51fca3a7a0u, 0xf75a15862ca504c5u,
+    0x82ef85133de648c4u, 0x9a984d73dbe722fbu,
+    0xa3ab66580d5fdaf5u, 0xc13e60d0d2e0ebbau,
+    0xcc963fee10b7d1b3u, 0x318df905079926a8u,
+    0xffbbcfe994e5c61fu, 0xfdf17746497f7052u,
+    0x9fd561f1fd0f9bd3u, 0xfeb6ea8bedefa633u,
+    0xc7caba6e7c5382c8u, 0xfe64a52ee96b8fc0u,
+    0xf9bd690a1b68637bu, 0x3dfdce7aa3c673b0u,
+    0x9c1661a651213e2du, 0x06bea10ca65c084eu,
+    0xc31bfa0fe5698db8u, 0x486e494fcff30a62u,
+    0xf3e2f893dec3f126u, 0x5a89dba3c3efccfau,
+    0x986ddb5c6b3a76b7u, 0xf89629465a75e01cu,
+    0xbe89523386091465u, 0xf6bbb397f1135823u,
+    0xee2ba6c0678b597fu, 0x746aa07ded582e2cu,
+    0x94db483840b717efu, 0xa8c2a44eb4571cdcu,
+    0xba121a4650e4ddebu, 0x92f34d62616ce413u,
+    0xe896a0d7e51e1566u, 0x77b020baf9c81d17u,
+    0x915e2486ef32cd60u, 0x0ace1474dc1d122eu,
+    0xb5b5ada8aaff80b8u, 0x0d819992132456bau,
+    0xe3231912d5bf60e6u, 0x10e1fff697ed6c69u,
+    0x8df5efabc5979c8fu, 0xca8d3ffa1ef463c1u,
+    0xb1736b96b6fd83b3u, 0xbd308ff8a6b17cb2u,
+    0xddd0467c64bce4a0u, 0xac7cb3f6d05ddbdeu,
+    0x8aa22c0dbef60ee4u, 0x6bcdf07a423aa96bu,
+    0xad4ab7112eb3929du, 0x86c16c98d2c953c6u,
+    0xd89d64d57a607744u, 0xe871c7bf077ba8b7u,
+    0x87625f056c7c4a8bu, 0x11471cd764ad4972u,
+    0xa93af6c6c79b5d2du, 0xd598e40d3dd89bcfu,
+    0xd389b47879823479u, 0x4aff1d108d4ec2c3u,
+    0x843610cb4bf160cbu, 0xcedf722a585139bau,
+    0xa54394fe1eedb8feu, 0xc2974eb4ee658828u,
+    0xce947a3da6a9273eu, 0x733d226229feea32u,
+    0x811ccc668829b887u, 0x0806357d5a3f525fu,
+    0xa163ff802a3426a8u, 0xca07c2dcb0cf26f7u,
+    0xc9bcff6034c13052u, 0xfc89b393dd02f0b5u,
+    0xfc2c3f3841f17c67u, 0xbbac2078d443ace2u,
+    0x9d9ba7832936edc0u, 0xd54b944b84aa4c0du,
+    0xc5029163f384a931u, 0x0a9e795e65d4df11u,
+    0xf64335bcf065d37du, 0x4d4617b5ff4a16d5u,
+    0x99ea0196163fa42eu, 0x504bced1bf8e4e45u,
+    0xc06481fb9bcf8d39u, 0xe45ec2862f71e1d6u,
+    0xf07da27a82c37088u, 0x5d767327bb4e5a4cu,
+    0x964e858c91ba2655u, 0x3a6a07f8d510f86fu,
+    0xbbe226efb628afeau, 0x890489f70a55368bu,
+    0xeadab0aba3b2dbe5u, 0x2b45ac74ccea842eu,
+    0x92c8ae6b464fc96fu, 0x3b0b8bc90012929du,
+    0xb77ada0617e3bbcbu, 0x09ce6ebb40173744u,
+    0xe55990879ddcaabdu, 0xcc420a6a101d0515u,
+    0x8f57fa54c2a9eab6u, 0x9fa946824a12232du,
+    0xb32df8e9f3546564u, 0x47939822dc96abf9u,
+    0xdff9772470297ebdu, 0x59787e2b93bc56f7u,
+    0x8bfbea76c619ef36u, 0x57eb4edb3c55b65au,
+    0xaefae51477a06b03u, 0xede622920b6b23f1u,
+    0xdab99e59958885c4u, 0xe95fab368e45ecedu,
+    0x88b402f7fd75539bu, 0x11dbcb0218ebb414u,
+    0xaae103b5fcd2a881u, 0xd652bdc29f26a119u,
+    0xd59944a37c0752a2u, 0x4be76d3346f0495fu,
+    0x857fcae62d8493a5u, 0x6f70a4400c562ddbu,
+    0xa6dfbd9fb8e5b88eu, 0xcb4ccd500f6bb952u,
+    0xd097ad07a71f26b2u, 0x7e2000a41346a7a7u,
+    0x825ecc24c873782fu, 0x8ed400668c0c28c8u,
+    0xa2f67f2dfa90563bu, 0x728900802f0f32fau,
+    0xcbb41ef979346bcau, 0x4f2b40a03ad2ffb9u,
+    0xfea126b7d78186bcu, 0xe2f610c84987bfa8u,
+    0x9f24b832e6b0f436u, 0x0dd9ca7d2df4d7c9u,
+    0xc6ede63fa05d3143u, 0x91503d1c79720dbbu,
+    0xf8a95fcf88747d94u, 0x75a44c6397ce912au,
+    0x9b69dbe1b548ce7cu, 0xc986afbe3ee11abau,
+    0xc24452da229b021bu, 0xfbe85badce996168u,
+    0xf2d56790ab41c2a2u, 0xfae27299423fb9c3u,
+    0x97c560ba6b0919a5u, 0xdccd879fc967d41au,
+    0xbdb6b8e905cb600fu, 0x5400e987bbc1c920u,
+    0xed246723473e3813u, 0x290123e9aab23b68u,
+    0x9436c0760c86e30bu, 0xf9a0b6720aaf6521u,
+    0xb94470938fa89bceu, 0xf808e40e8d5b3e69u,
+    0xe7958cb87392c2c2u, 0xb60b1d1230b20e04u,
+    0x90bd77f3483bb9b9u, 0xb1c6f22b5e6f48c2u,
+    0xb4ecd5f01a4aa828u, 0x1e38aeb6360b1af3u,
+    0xe2280b6c20dd5232u, 0x25c6da63c38de1b0u,
+    0x8d590723948a535fu, 0x579c487e5a38ad0eu,
+    0xb0af48ec79ace837u, 0x2d835a9df0c6d851u,
+    0xdcdb1b2798182244u, 0xf8e431456cf88e65u,
+    0x8a08f0f8bf0f156bu, 0x1b8e9ecb641b58ffu,
+    0xac8b2d36eed2dac5u, 0xe272467e3d222f3fu,
+    0xd7adf884aa879177u, 0x5b0ed81dcc6abb0fu,
+    0x86ccbb52ea94baeau, 0x98e947129fc2b4e9u,
+    0xa87fea27a539e9a5u, 0x3f2398d747b36224u,
+    0xd29fe4b18e88640eu, 0x8eec7f0d19a03aadu,
+    0x83a3eeeef9153e89u, 0x1953cf68300424acu,
+    0xa48ceaaab75a8e2bu, 0x5fa8c3423c052dd7u,
+    0xcdb02555653131b6u, 0x3792f412cb06794du,
+    0x808e17555f3ebf11u, 0xe2bbd88bbee40bd0u,
+    0xa0b19d2ab70e6ed6u, 0x5b6aceaeae9d0ec4u,
+    0xc8de047564d20a8bu, 0xf245825a5a445275u,
+    0xfb158592be068d2eu, 0xeed6e2f0f0d56712u,
+    0x9ced737bb6c4183du, 0x55464dd69685606bu,
+    0xc428d05aa4751e4cu, 0xaa97e14c3c26b886u,
+    0xf53304714d9265dfu, 0xd53dd99f4b3066a8u,
+    0x993fe2c6d07b7fabu, 0xe546a8038efe4029u,
+    0xbf8fdb78849a5f96u, 0xde98520472bdd033u,
+    0xef73d256a5c0f77cu, 0x963e66858f6d4440u,
+    0x95a8637627989aadu, 0xdde7001379a44aa8u,
+    0xbb127c53b17ec159u, 0x5560c018580d5d52u,
+    0xe9d71b689dde71afu, 0xaab8f01e6e10b4a6u,
+    0x9226712162ab070du, 0xcab3961304ca70e8u,
+    0xb6b00d69bb55c8d1u, 0x3d607b97c5fd0d22u,
+    0xe45c10c42a2b3b05u, 0x8cb89a7db77c506au,
+    0x8eb98a7a9a5b04e3u, 0x77f3608e92adb242u,
+    0xb267ed1940f1c61cu, 0x55f038b237591ed3u,
+    0xdf01e85f912e37a3u, 0x6b6c46dec52f6688u,
+    0x8b61313bbabce2c6u, 0x2323ac4b3b3da015u,
+    0xae397d8aa96c1b77u, 0xabec975e0a0d081au,
+    0xd9c7dced53c72255u, 0x96e7bd358c904a21u,
+    0x881cea14545c7575u, 0x7e50d64177da2e54u,
+    0xaa242499697392d2u, 0xdde50bd1d5d0b9e9u,
+    0xd4ad2dbfc3d07787u, 0x955e4ec64b44e864u,
+    0x84ec3c97da624ab4u, 0xbd5af13bef0b113eu,
+    0xa6274bbdd0fadd61u, 0xecb1ad8aeacdd58eu,
+    0xcfb11ead453994bau, 0x67de18eda5814af2u,
+    0x81ceb32c4b43fcf4u, 0x80eacf948770ced7u,
+    0xa2425ff75e14fc31u, 0xa1258379a94d028du,
+    0xcad2f7f5359a3b3eu, 0x096ee45813a04330u,
+    0xfd87b5f28300ca0du, 0x8bca9d6e188853fcu,
+    0x9e74d1b791e07e48u, 0x775ea264cf55347eu,
+    0xc612062576589ddau, 0x95364afe032a819eu,
+    0xf79687aed3eec551u, 0x3a83ddbd83f52205u,
+    0x9abe14cd44753b52u, 0xc4926a9672793543u,
+    0xc16d9a0095928a27u, 0x75b7053c0f178294u,
+    0xf1c90080baf72cb1u, 0x5324c68b12dd6339u,
+    0x971da05074da7beeu, 0xd3f6fc16ebca5e04u,
+    0xbce5086492111aeau, 0x88f4bb1ca6bcf585u,
+    0xec1e4a7db69561a5u, 0x2b31e9e3d06c32e6u,
+    0x9392ee8e921d5d07u, 0x3aff322e62439fd0u,
+    0xb877aa3236a4b449u, 0x09befeb9fad487c3u,
+    0xe69594bec44de15bu, 0x4c2ebe687989a9b4u,
+    0x901d7cf73ab0acd9u, 0x0f9d37014bf60a11u,
+    0xb424dc35095cd80fu, 0x538484c19ef38c95u,
+    0xe12e13424bb40e13u, 0x2865a5f206b06fbau,
+    0x8cbccc096f5088cbu, 0xf93f87b7442e45d4u,
+    0xafebff0bcb24aafeu, 0xf78f69a51539d749u,
+    0xdbe6fecebdedd5beu, 0xb573440e5a884d1cu,
+    0x89705f4136b4a597u, 0x31680a88f8953031u,
+    0xabcc77118461cefcu, 0xfdc20d2b36ba7c3eu,
+    0xd6bf94d5e57a42bcu, 0x3d32907604691b4du,
+    0x8637bd05af6c69b5u, 0xa63f9a49c2c1b110u,
+    0xa7c5ac471b478423u, 0x0fcf80dc33721d54u,
+    0xd1b71758e219652bu, 0xd3c36113404ea4a9u,
+    0x83126e978d4fdf3bu, 0x645a1cac083126eau,
+    0xa3d70a3d70a3d70au, 0x3d70a3d70a3d70a4u,
+    0xccccccccccccccccu, 0xcccccccccccccccdu,
+    0x8000000000000000u, 0x0000000000000000u,
+    0xa000000000000000u, 0x0000000000000000u,
+    0xc800000000000000u, 0x0000000000000000u,
+    0xfa00000000000000u, 0x0000000000000000u,
+    0x9c40000000000000u, 0x0000000000000000u,
+    0xc350000000000000u, 0x0000000000000000u,
+    0xf424000000000000u, 0x0000000000000000u,
+    0x9896800000000000u, 0x0000000000000000u,
+    0xbebc200000000000u, 0x0000000000000000u,
+    0xee6b280000000000u, 0x0000000000000000u,
+    0x9502f90000000000u, 0x0000000000000000u,
+    0xba43b74000000000u, 0x0000000000000000u,
+    0xe8d4a51000000000u, 0x0000000000000000u,
+    0x9184e72a00000000u, 0x0000000000000000u,
+    0xb5e620f480000000u, 0x0000000000000000u,
+    0xe35fa931a0000000u, 0x0000000000000000u,
+    0x8e1bc9bf04000000u, 0x0000000000000000u,
+    0xb1a2bc2ec5000000u, 0x0000000000000000u,
+    0xde0b6b3a76400000u, 0x0000000000000000u,
+    0x8ac7230489e80000u, 0x0000000000000000u,
+    0xad78ebc5ac620000u, 0x0000000000000000u,
+    0xd8d726b7177a8000u, 0x0000000000000000u,
+    0x878678326eac9000u, 0x0000000000000000u,
+    0xa968163f0a57b400u, 0x0000000000000000u,
+    0xd3c21bcecceda100u, 0x0000000000000000u,
+    0x84595161401484a0u, 0x0000000000000000u,
+    0xa56fa5b99019a5c8u, 0x0000000000000000u,
+    0xcecb8f27f4200f3au, 0x0000000000000000u,
+    0x813f3978f8940984u, 0x4000000000000000u,
+    0xa18f07d736b90be5u, 0x5000000000000000u,
+    0xc9f2c9cd04674edeu, 0xa400000000000000u,
+    0xfc6f7c4045812296u, 0x4d00000000000000u,
+    0x9dc5ada82b70b59du, 0xf020000000000000u,
+    0xc5371912364ce305u, 0x6c28000000000000u,
+    0xf684df56c3e01bc6u, 0xc732000000000000u,
+    0x9a130b963a6c115cu, 0x3c7f400000000000u,
+    0xc097ce7bc90715b3u, 0x4b9f100000000000u,
+    0xf0bdc21abb48db20u, 0x1e86d40000000000u,
+    0x96769950b50d88f4u, 0x1314448000000000u,
+    0xbc143fa4e250eb31u, 0x17d955a000000000u,
+    0xeb194f8e1ae525fdu, 0x5dcfab0800000000u,
+    0x92efd1b8d0cf37beu, 0x5aa1cae500000000u,
+    0xb7abc627050305adu, 0xf14a3d9e40000000u,
+    0xe596b7b0c643c719u, 0x6d9ccd05d0000000u,
+    0x8f7e32ce7bea5c6fu, 0xe4820023a2000000u,
+    0xb35dbf821ae4f38bu, 0xdda2802c8a800000u,
+    0xe0352f62a19e306eu, 0xd50b2037ad200000u,
+    0x8c213d9da502de45u, 0x4526f422cc340000u,
+    0xaf298d050e4395d6u, 0x9670b12b7f410000u,
+    0xdaf3f04651d47b4cu, 0x3c0cdd765f114000u,
+    0x88d8762bf324cd0fu, 0xa5880a69fb6ac800u,
+    0xab0e93b6efee0053u, 0x8eea0d047a457a00u,
+    0xd5d238a4abe98068u, 0x72a4904598d6d880u,
+    0x85a36366eb71f041u, 0x47a6da2b7f864750u,
+    0xa70c3c40a64e6c51u, 0x999090b65f67d924u,
+    0xd0cf4b50cfe20765u, 0xfff4b4e3f741cf6du,
+    0x82818f1281ed449fu, 0xbff8f10e7a8921a4u,
+    0xa321f2d7226895c7u, 0xaff72d52192b6a0du,
+    0xcbea6f8ceb02bb39u, 0x9bf4f8a69f764490u,
+    0xfee50b7025c36a08u, 0x02f236d04753d5b4u,
+    0x9f4f2726179a2245u, 0x01d762422c946590u,
+    0xc722f0ef9d80aad6u, 0x424d3ad2b7b97ef5u,
+    0xf8ebad2b84e0d58bu, 0xd2e0898765a7deb2u,
+    0x9b934c3b330c8577u, 0x63cc55f49f88eb2fu,
+    0xc2781f49ffcfa6d5u, 0x3cbf6b71c76b25fbu,
+    0xf316271c7fc3908au, 0x8bef464e3945ef7au,
+    0x97edd871cfda3a56u, 0x97758bf0e3cbb5acu,
+    0xbde94e8e43d0c8ecu, 0x3d52eeed1cbea317u,
+    0xed63a231d4c4fb27u, 0x4ca7aaa863ee4bddu,
+    0x945e455f24fb1cf8u, 0x8fe8caa93e74ef6au,
+    0xb975d6b6ee39e436u, 0xb3e2fd538e122b44u,
+    0xe7d34c64a9c85d44u, 0x60dbbca87196b616u,
+    0x90e40fbeea1d3a4au, 0xbc8955e946fe31cdu,
+    0xb51d13aea4a488ddu, 0x6babab6398bdbe41u,
+    0xe264589a4dcdab14u, 0xc696963c7eed2dd1u,
+    0x8d7eb76070a08aecu, 0xfc1e1de5cf543ca2u,
+    0xb0de65388cc8ada8u, 0x3b25a55f43294bcbu,
+    0xdd15fe86affad912u, 0x49ef0eb713f39ebeu,
+    0x8a2dbf142dfcc7abu, 0x6e3569326c784337u,
+    0xacb92ed9397bf996u, 0x49c2c37f07965404u,
+    0xd7e77a8f87daf7fbu, 0xdc33745ec97be906u,
+    0x86f0ac99b4e8dafdu, 0x69a028bb3ded71a3u,
+    0xa8acd7c0222311bcu, 0xc40832ea0d68ce0cu,
+    0xd2d80db02aabd62bu, 0xf50a3fa490c30190u,
+    0x83c7088e1aab65dbu, 0x792667c6da79e0fau,
+    0xa4b8cab1a1563f52u, 0x577001b891185938u,
+    0xcde6fd5e09abcf26u, 0xed4c0226b55e6f86u,
+    0x80b05e5ac60b6178u, 0x544f8158315b05b4u,
+    0xa0dc75f1778e39d6u, 0x696361ae3db1c721u,
+    0xc913936dd571c84cu, 0x03bc3a19cd1e38e9u,
+    0xfb5878494ace3a5fu, 0x04ab48a04065c723u,
+    0x9d174b2dcec0e47bu, 0x62eb0d64283f9c76u,
+    0xc45d1df942711d9au, 0x3ba5d0bd324f8394u,
+    0xf5746577930d6500u, 0xca8f44ec7ee36479u,
+    0x9968bf6abbe85f20u, 0x7e998b13cf4e1ecbu,
+    0xbfc2ef456ae276e8u, 0x9e3fedd8c321a67eu,
+    0xefb3ab16c59b14a2u, 0xc5cfe94ef3ea101eu,
+    0x95d04aee3b80ece5u, 0xbba1f1d158724a12u,
+    0xbb445da9ca61281fu, 0x2a8a6e45ae8edc97u,
+    0xea1575143cf97226u, 0xf52d09d71a3293bdu,
+    0x924d692ca61be758u, 0x593c2626705f9c56u,
+    0xb6e0c377cfa2e12eu, 0x6f8b2fb00c77836cu,
+    0xe498f455c38b997au, 0x0b6dfb9c0f956447u,
+    0x8edf98b59a373fecu, 0x4724bd4189bd5eacu,
+    0xb2977ee300c50fe7u, 0x58edec91ec2cb657u,
+    0xdf3d5e9bc0f653e1u, 0x2f2967b66737e3edu,
+    0x8b865b215899f46cu, 0xbd79e0d20082ee74u,
+    0xae67f1e9aec07187u, 0xecd8590680a3aa11u,
+    0xda01ee641a708de9u, 0xe80e6f4820cc9495u,
+    0x884134fe908658b2u, 0x3109058d147fdcddu,
+    0xaa51823e34a7eedeu, 0xbd4b46f0599fd415u,
+    0xd4e5e2cdc1d1ea96u, 0x6c9e18ac7007c91au,
+    0x850fadc09923329eu, 0x03e2cf6bc604ddb0u,
+    0xa6539930bf6bff45u, 0x84db8346b786151cu,
+    0xcfe87f7cef46ff16u, 0xe612641865679a63u,
+    0x81f14fae158c5f6eu, 0x4fcb7e8f3f60c07eu,
+    0xa26da3999aef7749u, 0xe3be5e330f38f09du,
+    0xcb090c8001ab551cu, 0x5cadf5bfd3072cc5u,
+    0xfdcb4fa002162a63u, 0x73d9732fc7c8f7f6u,
+    0x9e9f11c4014dda7eu, 0x2867e7fddcdd9afau,
+    0xc646d63501a1511du, 0xb281e1fd541501b8u,
+    0xf7d88bc24209a565u, 0x1f225a7ca91a4226u,
+    0x9ae757596946075fu, 0x3375788de9b06958u,
+    0xc1a12d2fc3978937u, 0x0052d6b1641c83aeu,
+    0xf209787bb47d6b84u, 0xc0678c5dbd23a49au,
+    0x9745eb4d50ce6332u, 0xf840b7ba963646e0u,
+    0xbd176620a501fbffu, 0xb650e5a93bc3d898u,
+    0xec5d3fa8ce427affu, 0xa3e51f138ab4cebeu,
+    0x93ba47c980e98cdfu, 0xc66f336c36b10137u,
+    0xb8a8d9bbe123f017u, 0xb80b0047445d4184u,
+    0xe6d3102ad96cec1du, 0xa60dc059157491e5u,
+    0x9043ea1ac7e41392u, 0x87c89837ad68db2fu,
+    0xb454e4a179dd1877u, 0x29babe4598c311fbu,
+    0xe16a1dc9d8545e94u, 0xf4296dd6fef3d67au,
+    0x8ce2529e2734bb1du, 0x1899e4a65f58660cu,
+    0xb01ae745b101e9e4u, 0x5ec05dcff72e7f8fu,
+    0xdc21a1171d42645du, 0x76707543f4fa1f73u,
+    0x899504ae72497ebau, 0x6a06494a791c53a8u,
+    0xabfa45da0edbde69u, 0x0487db9d17636892u,
+    0xd6f8d7509292d603u, 0x45a9d2845d3c42b6u,
+    0x865b86925b9bc5c2u, 0x0b8a2392ba45a9b2u,
+    0xa7f26836f282b732u, 0x8e6cac7768d7141eu,
+    0xd1ef0244af2364ffu, 0x3207d795430cd926u,
+    0x8335616aed761f1fu, 0x7f44e6bd49e807b8u,
+    0xa402b9c5a8d3a6e7u, 0x5f16206c9c6209a6u,
+    0xcd036837130890a1u, 0x36dba887c37a8c0fu,
+    0x802221226be55a64u, 0xc2494954da2c9789u,
+    0xa02aa96b06deb0fdu, 0xf2db9baa10b7bd6cu,
+    0xc83553c5c8965d3du, 0x6f92829494e5acc7u,
+    0xfa42a8b73abbf48cu, 0xcb772339ba1f17f9u,
+    0x9c69a97284b578d7u, 0xff2a760414536efbu,
+    0xc38413cf25e2d70du, 0xfef5138519684abau,
+    0xf46518c2ef5b8cd1u, 0x7eb258665fc25d69u,
+    0x98bf2f79d5993802u, 0xef2f773ffbd97a61u,
+    0xbeeefb584aff8603u, 0xaafb550ffacfd8fau,
+    0xeeaaba2e5dbf6784u, 0x95ba2a53f983cf38u,
+    0x952ab45cfa97a0b2u, 0xdd945a747bf26183u,
+    0xba756174393d88dfu, 0x94f971119aeef9e4u,
+    0xe912b9d1478ceb17u, 0x7a37cd5601aab85du,
+    0x91abb422ccb812eeu, 0xac62e055c10ab33au,
+    0xb616a12b7fe617aau, 0x577b986b314d6009u,
+    0xe39c49765fdf9d94u, 0xed5a7e85fda0b80bu,
+    0x8e41ade9fbebc27du, 0x14588f13be847307u,
+    0xb1d219647ae6b31cu, 0x596eb2d8ae258fc8u,
+    0xde469fbd99a05fe3u, 0x6fca5f8ed9aef3bbu,
+    0x8aec23d680043beeu, 0x25de7bb9480d5854u,
+    0xada72ccc20054ae9u, 0xaf561aa79a10ae6au,
+    0xd910f7ff28069da4u, 0x1b2ba1518094da04u,
+    0x87aa9aff79042286u, 0x90fb44d2f05d0842u,
+    0xa99541bf57452b28u, 0x353a1607ac744a53u,
+    0xd3fa922f2d1675f2u, 0x42889b8997915ce8u,
+    0x847c9b5d7c2e09b7u, 0x69956135febada11u,
+    0xa59bc234db398c25u, 0x43fab9837e699095u,
+    0xcf02b2c21207ef2eu, 0x94f967e45e03f4bbu,
+    0x8161afb94b44f57du, 0x1d1be0eebac278f5u,
+    0xa1ba1ba79e1632dcu, 0x6462d92a69731732u,
+    0xca28a291859bbf93u, 0x7d7b8f7503cfdcfeu,
+    0xfcb2cb35e702af78u, 0x5cda735244c3d43eu,
+    0x9defbf01b061adabu, 0x3a0888136afa64a7u,
+    0xc56baec21c7a1916u, 0x088aaa1845b8fdd0u,
+    0xf6c69a72a3989f5bu, 0x8aad549e57273d45u,
+    0x9a3c2087a63f6399u, 0x36ac54e2f678864bu,
+    0xc0cb28a98fcf3c7fu, 0x84576a1bb416a7ddu,
+    0xf0fdf2d3f3c30b9fu, 0x656d44a2a11c51d5u,
+    0x969eb7c47859e743u, 0x9f644ae5a4b1b325u,
+    0xbc4665b596706114u, 0x873d5d9f0dde1feeu,
+    0xeb57ff22fc0c7959u, 0xa90cb506d155a7eau,
+    0x9316ff75dd87cbd8u, 0x09a7f12442d588f2u,
+    0xb7dcbf5354e9beceu, 0x0c11ed6d538aeb2fu,
+    0xe5d3ef282a242e81u, 0x8f1668c8a86da5fau,
+    0x8fa475791a569d10u, 0xf96e017d694487bcu,
+    0xb38d92d760ec4455u, 0x37c981dcc395a9acu,
+    0xe070f78d3927556au, 0x85bbe253f47b1417u,
+    0x8c469ab843b89562u, 0x93956d7478ccec8eu,
+    0xaf58416654a6babbu, 0x387ac8d1970027b2u,
+    0xdb2e51bfe9d0696au, 0x06997b05fcc0319eu,
+    0x88fcf317f22241e2u, 0x441fece3bdf81f03u,
+    0xab3c2fddeeaad25au, 0xd527e81cad7626c3u,
+    0xd60b3bd56a5586f1u, 0x8a71e223d8d3b074u,
+    0x85c7056562757456u, 0xf6872d5667844e49u,
+    0xa738c6bebb12d16cu, 0xb428f8ac016561dbu,
+    0xd106f86e69d785c7u, 0xe13336d701beba52u,
+    0x82a45b450226b39cu, 0xecc0024661173473u,
+    0xa34d721642b06084u, 0x27f002d7f95d0190u,
+    0xcc20ce9bd35c78a5u, 0x31ec038df7b441f4u,
+    0xff290242c83396ceu, 0x7e67047175a15271u,
+    0x9f79a169bd203e41u, 0x0f0062c6e984d386u,
+    0xc75809c42c684dd1u, 0x52c07b78a3e60868u,
+    0xf92e0c3537826145u, 0xa7709a56ccdf8a82u,
+    0x9bbcc7a142b17ccbu, 0x88a66076400bb691u,
+    0xc2abf989935ddbfeu, 0x6acff893d00ea435u,
+    0xf356f7ebf83552feu, 0x0583f6b8c4124d43u,
+    0x98165af37b2153deu, 0xc3727a337a8b704au,
+    0xbe1bf1b059e9a8d6u, 0x744f18c0592e4c5cu,
+    0xeda2ee1c7064130cu, 0x1162def06f79df73u,
+    0x9485d4d1c63e8be7u, 0x8addcb5645ac2ba8u,
+    0xb9a74a0637ce2ee1u, 0x6d953e2bd7173692u,
+    0xe8111c87c5c1ba99u, 0xc8fa8db6ccdd0437u,
+    0x910ab1d4db9914a0u, 0x1d9c9892400a22a2u,
+    0xb54d5e4a127f59c8u, 0x2503beb6d00cab4bu,
+    0xe2a0b5dc971f303au, 0x2e44ae64840fd61du,
+    0x8da471a9de737e24u, 0x5ceaecfed289e5d2u,
+    0xb10d8e1456105dadu, 0x7425a83e872c5f47u,
+    0xdd50f1996b947518u, 0xd12f124e28f77719u,
+    0x8a5296ffe33cc92fu, 0x82bd6b70d99aaa6fu,
+    0xace73cbfdc0bfb7bu, 0x636cc64d1001550bu,
+    0xd8210befd30efa5au, 0x3c47f7e05401aa4eu,
+    0x8714a775e3e95c78u, 0x65acfaec34810a71u,
+    0xa8d9d1535ce3b396u, 0x7f1839a741a14d0du,
+    0xd31045a8341ca07cu, 0x1ede48111209a050u,
+    0x83ea2b892091e44du, 0x934aed0aab460432u,
+    0xa4e4b66b68b65d60u, 0xf81da84d5617853fu,
+    0xce1de40642e3f4b9u, 0x36251260ab9d668eu,
+    0x80d2ae83e9ce78f3u, 0xc1d72b7c6b426019u,
+    0xa1075a24e4421730u, 0xb24cf65b8612f81fu,
+    0xc94930ae1d529cfcu, 0xdee033f26797b627u,
+    0xfb9b7cd9a4a7443cu, 0x169840ef017da3b1u,
+    0x9d412e0806e88aa5u, 0x8e1f289560ee864eu,
+    0xc491798a08a2ad4eu, 0xf1a6f2bab92a27e2u,
+    0xf5b5d7ec8acb58a2u, 0xae10af696774b1dbu,
+    0x9991a6f3d6bf1765u, 0xacca6da1e0a8ef29u,
+    0xbff610b0cc6edd3fu, 0x17fd090a58d32af3u,
+    0xeff394dcff8a948eu, 0xddfc4b4cef07f5b0u,
+    0x95f83d0a1fb69cd9u, 0x4abdaf101564f98eu,
+    0xbb764c4ca7a4440fu, 0x9d6d1ad41abe37f1u,
+    0xea53df5fd18d5513u, 0x84c86189216dc5edu,
+    0x92746b9be2f8552cu, 0x32fd3cf5b4e49bb4u,
+    0xb7118682dbb66a77u, 0x3fbc8c33221dc2a1u,
+    0xe4d5e82392a40515u, 0x0fabaf3feaa5334au,
+    0x8f05b1163ba6832du, 0x29cb4d87f2a7400eu,
+    0xb2c71d5bca9023f8u, 0x743e20e9ef511012u,
+    0xdf78e4b2bd342cf6u, 0x914da9246b255416u,
+    0x8bab8eefb6409c1au, 0x1ad089b6c2f7548eu,
+    0xae9672aba3d0c320u, 0xa184ac2473b529b1u,
+    0xda3c0f568cc4f3e8u, 0xc9e5d72d90a2741eu,
+    0x8865899617fb1871u, 0x7e2fa67c7a658892u,
+    0xaa7eebfb9df9de8du, 0xddbb901b98feeab7u,
+    0xd51ea6fa85785631u, 0x552a74227f3ea565u,
+    0x8533285c936b35deu, 0xd53a88958f87275fu,
+    0xa67ff273b8460356u, 0x8a892abaf368f137u,
+    0xd01fef10a657842cu, 0x2d2b7569b0432d85u,
+    0x8213f56a67f6b29bu, 0x9c3b29620e29fc73u,
+    0xa298f2c501f45f42u, 0x8349f3ba91b47b8fu,
+    0xcb3f2f7642717713u, 0x241c70a936219a73u,
+    0xfe0efb53d30dd4d7u, 0xed238cd383aa0110u,
+    0x9ec95d1463e8a506u, 0xf4363804324a40aau,
+    0xc67bb4597ce2ce48u, 0xb143c6053edcd0d5u,
+    0xf81aa16fdc1b81dau, 0xdd94b7868e94050au,
+    0x9b10a4e5e9913128u, 0xca7cf2b4191c8326u,
+    0xc1d4ce1f63f57d72u, 0xfd1c2f611f63a3f0u,
+    0xf24a01a73cf2dccfu, 0xbc633b39673c8cecu,
+    0x976e41088617ca01u, 0xd5be0503e085d813u,
+    0xbd49d14aa79dbc82u, 0x4b2d8644d8a74e18u,
+    0xec9c459d51852ba2u, 0xddf8e7d60ed1219eu,
+    0x93e1ab8252f33b45u, 0xcabb90e5c942b503u,
+    0xb8da1662e7b00a17u, 0x3d6a751f3b936243u,
+    0xe7109bfba19c0c9du, 0x0cc512670a783ad4u,
+    0x906a617d450187e2u, 0x27fb2b80668b24c5u,
+    0xb484f9dc9641e9dau, 0xb1f9f660802dedf6u,
+    0xe1a63853bbd26451u, 0x5e7873f8a0396973u,
+    0x8d07e33455637eb2u, 0xdb0b487b6423e1e8u,
+    0xb049dc016abc5e5fu, 0x91ce1a9a3d2cda62u,
+    0xdc5c5301c56b75f7u, 0x7641a140cc7810fbu,
+    0x89b9b3e11b6329bau, 0xa9e904c87fcb0a9du,
+    0xac2820d9623bf429u, 0x546345fa9fbdcd44u,
+    0xd732290fbacaf133u, 0xa97c177947ad4095u,
+    0x867f59a9d4bed6c0u, 0x49ed8eabcccc485du,
+    0xa81f301449ee8c70u, 0x5c68f256bfff5a74u,
+    0xd226fc195c6a2f8cu, 0x73832eec6fff3111u,
+    0x83585d8fd9c25db7u, 0xc831fd53c5ff7eabu,
+    0xa42e74f3d032f525u, 0xba3e7ca8b77f5e55u,
+    0xcd3a1230c43fb26fu, 0x28ce1bd2e55f35ebu,
+    0x80444b5e7aa7cf85u, 0x7980d163cf5b81b3u,
+    0xa0555e361951c366u, 0xd7e105bcc332621fu,
+    0xc86ab5c39fa63440u, 0x8dd9472bf3fefaa7u,
+    0xfa856334878fc150u, 0xb14f98f6f0feb951u,
+    0x9c935e00d4b9d8d2u, 0x6ed1bf9a569f33d3u,
+    0xc3b8358109e84f07u, 0x0a862f80ec4700c8u,
+    0xf4a642e14c6262c8u, 0xcd27bb612758c0fau,
+    0x98e7e9cccfbd7dbdu, 0x8038d51cb897789cu,
+    0xbf21e44003acdd2cu, 0xe0470a63e6bd56c3u,
+    0xeeea5d5004981478u, 0x1858ccfce06cac74u,
+    0x95527a5202df0ccbu, 0x0f37801e0c43ebc8u,
+    0xbaa718e68396cffdu, 0xd30560258f54e6bau,
+    0xe950df20247c83fdu, 0x47c6b82ef32a2069u,
+    0x91d28b7416cdd27eu, 0x4cdc331d57fa5441u,
+    0xb6472e511c81471du, 0xe0133fe4adf8e952u,
+    0xe3d8f9e563a198e5u, 0x58180fddd97723a6u,
+    0x8e679c2f5e44ff8fu, 0x570f09eaa7ea7648u
+};
+
+/**
+ * @brief Load 8 bytes as an integer whose least significant byte is the first of them, whatever the byte order of the machine.
+ * @param data A pointer to at least 8 bytes.
+ * @returns The loaded integer.
+ */
+static uint64_t _string_load_eight(const char *data)
+{
+    uint64_t chunk;
+    memcpy(&chunk, data, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap64(chunk);
+#endif
+    return chunk;
+}
+
+/**
+ * @brief Determine whether all 8 bytes of a chunk are decimal digits. A byte is a digit if its high half is `3` and adding `6` to it does not carry into the high half.
+ * @param chunk The chunk to check.
+ * @returns A boolean on whether every byte is a digit.
+ */
+static bool _string_is_eight_digits(uint64_t chunk)
+{
+    return ((chunk & 0xF0F0F0F0F0F0F0F0u) | (((chunk + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) == 0x3333333333333333u;
+}
+
+/**
+ * @brief Convert a chunk of 8 decimal digits into their value by combining neighbouring digits, then pairs, then quadruples, in three multiplications.
+ * @param chunk A chunk whose every byte is a digit, loaded with `_string_load_eight`.
+ * @returns The value of the digits, from 0 to 99999999.
+ */
+static uint64_t _string_parse_eight_digits(uint64_t chunk)
+{
+    const uint64_t mask = 0x000000FF000000FFu;
+    chunk -= 0x3030303030303030u;
+    chunk = chunk * 10 + (chunk >> 8);
+    return ((chunk & mask) * (100 + (1000000ull << 32)) + ((chunk >> 16) & mask) * (1 + (10000ull << 32))) >> 32;
+}
+
+/**
+ * @brief Parse a run of decimal digits into an unsigned integer, 8 digits at a time while 8 are left, never reading past the end of the range.
+ * @param data A pointer to the start of the range.
+ * @param count The number of bytes in the range.
+ * @param value A pointer to where the value is written; `UINT64_MAX` on overflow.
+ * @param overflow A pointer to where it is written whether the value overflows. Digits are still consumed after an overflow.
+ * @returns The number of digits consumed.
+ */
+static size_t _string_parse_digits(const char *data, size_t count, uint64_t *value, bool *overflow)
+{
+    uint64_t result = 0;
+    bool wrapped = false;
+    size_t index = 0;
+    while (count - index >= 8)
+    {
+        const uint64_t chunk = _string_load_eight(data + index);
+        if (!_string_is_eight_digits(chunk))
+        {
+            break;
+        }
+        const uint64_t digits = _string_parse_eight_digits(chunk);
+        if (result > (UINT64_MAX - digits) / 100000000u)
+        {
+            wrapped = true;
+        }
+        result = result * 100000000u + digits;
+        index += 8;
+    }
+    for (; index < count && data[index] >= '0' && data[index] <= '9'; index++)
+    {
+        const uint64_t digit = (uint64_t)(data[index] - '0');
+        if (result > (UINT64_MAX - digit) / 10)
+        {
+            wrapped = true;
+        }
+        result = result * 10 + digit;
+    }
+    *value = wrapped ? UINT64_MAX : result;
+    *overflow = wrapped;
+    return index;
+}
+
+/**
+ * @brief Accumulate the significant digits of a floating point number into a mantissa of at most 19 digits, which always fits in 64 bits. Digits past the 19th are dropped and only scale the number.
+ * @param data A pointer to the start of the digits.
+ * @param count The number of bytes left in the string.
+ * @param fraction Whether the digits follow the decimal point, in which case each kept digit divides the number by ten.
+ * @param mantissa A pointer to the mantissa to accumulate into.
+ * @param digits A pointer to the number of digits already in the mantissa.
+ * @param exponent A pointer to the power of ten by which the mantissa is scaled.
+ * @param truncated A pointer to a flag set if a non-zero digit is dropped.
+ * @returns The number of digits consumed.
+ */
+static size_t _string_parse_significand(const char *data, size_t count, bool fraction, uint64_t *mantissa, size_t *digits, int64_t *exponent, bool *truncated)
+{
+    size_t index = 0;
+    while (*digits + 8 <= 19 && count - index >= 8)
+    {
+        const uint64_t chunk = _string_load_eight(data + index);
+        if (!_string_is_eight_digits(chunk))
+        {
+            break;
+        }
+        *mantissa = *mantissa * 100000000u + _string_parse_eight_digits(chunk);
+        *digits += 8;
+        *exponent -= fraction ? 8 : 0;
+        index += 8;
+    }
+    for (; index < count && data[index] >= '0' && data[index] <= '9'; index++)
+    {
+        if (*digits < 19)
+        {
+            *mantissa = *mantissa * 10 + (uint64_t)(data[index] - '0');
+            *digits += 1;
+            *exponent -= fraction ? 1 : 0;
+        }
+        else
+        {
+            *truncated |= data[index] != '0';
+            *exponent += fraction ? 0 : 1;
+        }
+    }
+    return index;
+}
+
+/**
+ * @brief Multiply two 64-bit integers into their full 128-bit product.
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param high A pointer to where the high 64 bits of the product are written.
+ * @returns The low 64 bits of the product.
+ */
+static uint64_t _string_multiply(uint64_t a, uint64_t b, uint64_t *high)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    const uint128_t product = (uint128_t)a * b;
+    *high = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+#else
+    const uint64_t a_low = (uint32_t)a, a_high = a >> 32;
+    const uint64_t b_low = (uint32_t)b, b_high = b >> 32;
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t middle = (low_low >> 32) + (uint32_t)high_low + (uint32_t)low_high;
+    *high = a_high * b_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    return (middle << 32) | (uint32_t)low_low;
+#endif
+}
+
+/**
+ * @brief Count the leading zero bits of a non-zero 64-bit integer.
+ * @param value The integer, which must not be zero.
+ * @returns The number of leading zero bits.
+ */
+static int _string_leading_zeroes(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int zeroes = 0;
+    for (; !(value & 0x8000000000000000u); value <<= 1)
+    {
+        zeroes++;
+    }
+    return zeroes;
+#endif
+}
+
+/**
+ * @brief Round `mantissa * 10^power` to the nearest double with the Eisel-Lemire algorithm: the mantissa is multiplied by a 128-bit truncation of the power of ten, which almost always has enough precision to round correctly; when it does not, or the result is subnormal, the algorithm says so rather than guessing.
+ * @param mantissa The non-zero decimal mantissa.
+ * @param power The power of ten, from `_STRING_SMALLEST_POWER` to `_STRING_LARGEST_POWER`.
+ * @param value A pointer to where the magnitude of the double is written.
+ * @returns A boolean on whether the result is known to be correctly rounded.
+ */
+static bool _string_eisel_lemire(uint64_t mantissa, int64_t power, double *value)
+{
+    const uint64_t *factor = &_string_powers_of_five[2 * (power - _STRING_SMALLEST_POWER)];
+    // floor(log2(10^power)), plus the bias of the exponent and the 63 bits the product is shifted by.
+    const int64_t exponent = (((152170 + 65536) * power) >> 16) + 1024 + 63;
+    int zeroes = _string_leading_zeroes(mantissa);
+    mantissa <<= zeroes;
+    uint64_t upper;
+    uint64_t lower = _string_multiply(mantissa, factor[0], &upper);
+    // The 9 bits below the 55 that are kept are all ones, so the truncated bits of the factor may carry into them.
+    if ((upper & 0x1FF) == 0x1FF && lower + mantissa < lower)
+    {
+        uint64_t middle;
+        const uint64_t low = _string_multiply(mantissa, factor[1], &middle);
+        const uint64_t sum = lower + middle;
+        upper += sum < lower;
+        if (sum + 1 == 0 && (upper & 0x1FF) == 0x1FF && low + mantissa < low)
+        {
+            return false;
+        }
+        lower = sum;
+    }
+    const uint64_t top = upper >> 63;
+    uint64_t bits = upper >> (top + 9);
+    zeroes += (int)(1 ^ top);
+    // Exactly halfway between two doubles, which the truncated factor can not tell apart from slightly above or below.
+    if (lower == 0 && (upper & 0x1FF) == 0 && (bits & 3) == 1)
+    {
+        return false;
+    }
+    bits += bits & 1;
+    bits >>= 1;
+    if (bits >= (1ull << 53))
+    {
+        bits = 1ull << 52;
+        zeroes--;
+    }
+    bits &= ~(1ull << 52);
+    const int64_t biased = exponent - zeroes;
+    if (biased < 1 || biased > 2046)
+    {
+        return false;
+    }
+    bits |= (uint64_t)biased << 52;
+    memcpy(value, &bits, sizeof(*value));
+    return true;
+}
+
+/**
+ * @brief Round a number to the nearest double with the C library, for the rare cases that `_string_eisel_lemire` can not decide. The number is copied so that it is null terminated.
+ * @param data A pointer to the start of the number.
+ * @param count The number of bytes in the number.
+ * @returns The nearest double.
+ * @exception If a long number can not be copied, an `AllocationError` is printed to standard error and the programme exits.
+ */
+static double _string_parse_fallback(const char *data, size_t count)
+{
+    char local[64];
+    char *copy = count < sizeof(local) ? local : (char *)malloc(count + 1);
+    if (copy == NULL)
+    {
+        fprintf(stderr, "AllocationError: Can not allocate enough memory to parse a number.\n");
+        exit(1);
+    }
+    memcpy(copy, data, count);
+    copy[count] = '\0';
+    const double result = strtod(copy, NULL);
+    if (copy != local)
+    {
+        free(copy);
+    }
+    return result;
+}
+
+/**
+ * @brief Match a given word at the start of a range, ignoring case.
+ * @param data A pointer to the start of the range.
+ * @param count The number of bytes in the range.
+ * @param word The lowercase word to match.
+ * @returns The length of the word if it matches, otherwise `0`.
+ */
+static size_t _string_match_word(const char *data, size_t count, const char *word)
+{
+    const size_t length = strlen(word);
+    if (count < length)
+    {
+        return 0;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        if (tolower((unsigned char)data[i]) != word[i])
+        {
+            return 0;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Parse an unsigned decimal integer, with an optional leading `+`, from the start of a given string. Nothing past the digits is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to `UINT64_MAX` on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ */
+string_parse_t string_to_u64(const string_t *string, uint64_t *value)
+{
+    string_parse_t parse = {0, false};
+    const size_t sign = string->count > 0 && string->data[0] == '+';
+    uint64_t result;
+    const size_t digits = _string_parse_digits(string->data + sign, string->count - sign, &result, &parse.overflow);
+    if (digits == 0)
+    {
+        return parse;
+    }
+    parse.count = sign + digits;
+    *value = result;
+    return parse;
+}
+
+/**
+ * @brief Parse a signed decimal integer, with an optional leading `+` or `-`, from the start of a given string. Nothing past the digits is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to `INT64_MAX` or `INT64_MIN` on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ */
+string_parse_t string_to_i64(const string_t *string, int64_t *value)
+{
+    string_parse_t parse = {0, false};
+    const size_t sign = string->count > 0 && (string->data[0] == '+' || string->data[0] == '-');
+    const bool negative = sign && string->data[0] == '-';
+    uint64_t magnitude;
+    const size_t digits = _string_parse_digits(string->data + sign, string->count - sign, &magnitude, &parse.overflow);
+    if (digits == 0)
+    {
+        return parse;
+    }
+    // The magnitude of the smallest value is one more than that of the largest.
+    const uint64_t limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+    parse.overflow |= magnitude > limit;
+    parse.count = sign + digits;
+    if (parse.overflow)
+    {
+        *value = negative ? INT64_MIN : INT64_MAX;
+    }
+    else
+    {
+        *value = negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+    }
+    return parse;
+}
+
+/**
+ * @brief Parse a decimal floating point number, such as `-12.5e-3`, `inf` or `nan`, from the start of a given string. The result is correctly rounded. Nothing past the number is read, so the string does not need to be null terminated.
+ * @param string A pointer to the string to parse.
+ * @param value A pointer to where the parsed value is written. It is left untouched if no number is found, and set to an infinity on overflow.
+ * @returns The number of bytes consumed — `0` if the string does not start with a number — and whether the number overflows.
+ * @exception If a number of more than 19 significant digits can not be rounded without the C library, and can not be copied for it, an `AllocationError` is printed to standard error and the programme exits.
+ */
+string_parse_t string_to_f64(const string_t *string, double *value)
+{
+    string_parse_t parse = {0, false};
+    const char *data = string->data;
+    const size_t count = string->count;
+    size_t index = 0;
+    const bool negative = count > 0 && data[0] == '-';
+    if (count > 0 && (data[0] == '+' || data[0] == '-'))
+    {
+        index++;
+    }
+    if (index < count && (tolower((unsigned char)data[index]) == 'i' || tolower((unsigned char)data[index]) == 'n'))
+    {
+        size_t word = _string_match_word(data + index, count - index, "infinity");
+        word = word ? word : _string_match_word(data + index, count - index, "inf");
+        if (word)
+        {
+            parse.count = index + word;
+            *value = negative ? -HUGE_VAL : HUGE_VAL;
+            return parse;
+        }
+        word = _string_match_word(data + index, count - index, "nan");
+        if (word)
+        {
+            parse.count = index + word;
+            *value = negative ? -NAN : NAN;
+        }
+        return parse;
+    }
+
+    uint64_t mantissa = 0;
+    size_t digits = 0;
+    int64_t exponent = 0;
+    bool truncated = false;
+    // Leading zeros are not significant, so they are skipped to leave room for the digits that are.
+    const size_t start = index;
+    while (index < count && data[index] == '0')
+    {
+        index++;
+    }
+    index += _string_parse_significand(data + index, count - index, false, &mantissa, &digits, &exponent, &truncated);
+    size_t seen = index - start;
+    if (index < count && data[index] == '.')
+    {
+        const size_t point = ++index;
+        if (digits == 0)
+        {
+            for (; index < count && data[index] == '0'; index++)
+            {
+                exponent--;
+            }
+        }
+        index += _string_parse_significand(data + index, count - index, true, &mantissa, &digits, &exponent, &truncated);
+        seen += index - point;
+    }
+    if (seen == 0)
+    {
+        return parse;
+    }
+    if (index < count && (data[index] == 'e' || data[index] == 'E'))
+    {
+        size_t cursor = index + 1;
+        const bool below = cursor < count && data[cursor] == '-';
+        if (cursor < count && (data[cursor] == '+' || data[cursor] == '-'))
+        {
+            cursor++;
+        }
+        if (cursor < count && data[cursor] >= '0' && data[cursor] <= '9')
+        {
+            int64_t scale = 0;
+            for (; cursor < count && data[cursor] >= '0' && data[cursor] <= '9'; cursor++)
+            {
+                // Saturate well past any meaningful power of ten, so that the exponent can not overflow.
+                scale = scale < 100000 ? scale * 10 + (data[cursor] - '0') : scale;
+            }
+            exponent += below ? -scale : scale;
+            index = cursor;
+        }
+    }
+    parse.count = index;
+
+    double result;
+    if (mantissa == 0 || exponent < _STRING_SMALLEST_POWER)
+    {
+        result = 0.0;
+    }
+    else if (exponent > _STRING_LARGEST_POWER)
+    {
+        result = HUGE_VAL;
+    }
+    // Clinger's fast path: both the mantissa and the power of ten are exact doubles, so a single rounding gives the correct result.
+    else if (!truncated && FLT_EVAL_METHOD == 0 && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+    {
+        result = (double)mantissa;
+        result = exponent < 0 ? result / _string_exact_powers_of_ten[-exponent] : result * _string_exact_powers_of_ten[exponent];
+    }
+    else
+    {
+        // If digits were dropped, the number lies between the mantissa and the next one up; when both round the same way, so does the number.
+        double above;
+        const bool exact = _string_eisel_lemire(mantissa, exponent, &result)
+            && (!truncated || (_string_eisel_lemire(mantissa + 1, exponent, &above) && above == result));
+        if (!exact)
+        {
+            result = _string_parse_fallback(data + start, index - start);
+        }
+    }
+    parse.overflow = isinf(result);
+    *value = negative ? -result : result;
+    return parse;
+}
+
+/**
+ * @brief Load 4 bytes as an integer whose least significant byte is the first of them, whatever the byte order of the machine.
+ * @param data A pointer to at least 4 bytes.
+ * @returns The loaded integer.
+ */
+static uint64_t _string_load_four(const char *data)
+{
+    uint32_t chunk;
+    memcpy(&chunk, data, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap32(chunk);
+#endif
+    return chunk;
+}
+
+/**
+ * @brief Mix two 64-bit integers by folding their 128-bit product onto itself.
+ * @param a The first integer.
+ * @param b The second integer.
+ * @returns The exclusive or of the high and the low 64 bits of the product.
+ */
+static uint64_t _string_mix(uint64_t a, uint64_t b)
+{
+    uint64_t high;
+    const uint64_t low = _string_multiply(a, b, &high);
+    return low ^ high;
+}
+
+/**
+ * @brief Odd constants with an even number of set bits in every byte, which the hash mixes into its input.
+ */
+static const uint64_t _string_hash_secret[] = {0x2d358dccaa6c78a5u, 0x8bb84b93962eacc9u, 0x4b33a62ed433d4a3u, 0x4d5a2da51de1aa47u};
+
+/**
+ * @brief Hash a given string into 64 bits with the wyhash algorithm. The hash is not cryptographic, but it is fast, well distributed, and different seeds give unrelated hashes.
+ * @param string The string to hash.
+ * @param seed The seed with which to hash.
+ * @returns The 64-bit hash of the string.
+ */
+uint64_t string_hash(string_t string, uint64_t seed)
+{
+    const uint64_t *secret = _string_hash_secret;
+    const char *data = string.data;
+    const size_t count = string.count;
+    seed ^= _string_mix(seed ^ secret[0], secret[1]);
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (count <= 16)
+    {
+        if (count >= 4)
+        {
+            // Two overlapping pairs of 4 bytes cover every length from 4 to 16.
+            const size_t middle = (count >> 3) << 2;
+            a = (_string_load_four(data) << 32) | _string_load_four(data + middle);
+            b = (_string_load_four(data + count - 4) << 32) | _string_load_four(data + count - 4 - middle);
+        }
+        else if (count > 0)
+        {
+            a = ((uint64_t)(uint8_t)data[0] << 16) | ((uint64_t)(uint8_t)data[count >> 1] << 8) | (uint8_t)data[count - 1];
+        }
+    }
+    else
+    {
+        size_t left = count;
+        if (left > 48)
+        {
+            // Three independent lanes of 16 bytes, so that the multiplications can overlap.
+            uint64_t first = seed;
+            uint64_t second = seed;
+            do
+            {
+                seed = _string_mix(_string_load_eight(data) ^ secret[1], _string_load_eight(data + 8) ^ seed);
+                first = _string_mix(_string_load_eight(data + 16) ^ secret[2], _string_load_eight(data + 24) ^ first);
+                second = _string_mix(_string_load_eight(data + 32) ^ secret[3], _string_load_eight(data + 40) ^ second);
+                data += 48;
+                left -= 48;
+            }
+            while (left > 48);
+            seed ^= first ^ second;
+        }
+        while (left > 16)
+        {
+            seed = _string_mix(_string_load_eight(data) ^ secret[1], _string_load_eight(data + 8) ^ seed);
+            data += 16;
+            left -= 16;
+        }
+        a = _string_load_eight(data + left - 16);
+        b = _string_load_eight(data + left - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    uint64_t high;
+    const uint64_t low = _string_multiply(a, b, &high);
+    return _string_mix(low ^ secret[0] ^ count, high ^ secret[1]);
+}
+
+/**
+ * @brief Compare two given — case sensitive — string types.
+ * @param a The string to check against.
+ * @param b The string to which a comparison will be made in parametre `a`.
+ * @returns A boolean on wheather `a` and `b` are equal.
+ */
+bool string_equals(string_t a, string_t b)
+{
+    if (a.count != b.count)
+    {
+        return false;
+    }
+    return memcmp(a.data, b.data, a.count) == 0;
+}
+
+/**
+ * @brief Compare two given string types, ignoring the case of ASCII letters.
+ * @param a The string to check against.
+ * @param b The string to which a comparison will be made in parametre `a`.
+ * @returns A boolean on wheather `a` and `b` are equal once their ASCII letters are folded to one case.
+ */
+bool string_equals_ignore_case(string_t a, string_t b)
+{
+    if (a.count != b.count)
+    {
+        return false;
+    }
+#if STRING_VIEW_SIMD
+    if (a.count >= 32 && _string_has_avx2())
+    {
+        return _string_equals_ignore_case_avx2(a.data, b.data, a.count);
+    }
+    if (a.count >= 16)
+    {
+        return _string_equals_ignore_case_sse2(a.data, b.data, a.count);
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = 0; i < a.count; i++)
+    {
+        if (_string_fold_byte(a.data[i], 'A') != _string_fold_byte(b.data[i], 'A'))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Determine whether every byte of a given string is ASCII, that is below `0x80`.
+ * @param string A pointer to the string to check.
+ * @returns A boolean on whether the string is ASCII. An empty string is ASCII.
+ */
+bool string_is_ascii(const string_t *string)
+{
+#if STRING_VIEW_SIMD
+    if (string->count >= 16)
+    {
+        return _string_find_non_ascii_sse2(string->data, string->count) == STRING_NOT_FOUND;
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = 0; i < string->count; i++)
+    {
+        if ((unsigned char) string->data[i] >= 0x80)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Replacement charactor to which invalid UTF-8 is decoded.
+ */
+#define _STRING_UTF8_REPLACEMENT 0xFFFD
+
+/**
+ * @brief Decode the code point at the start of a range of UTF-8, checking the ranges of every byte of the sequence as in table 3-7 of the Unicode standard.
+ * @param data Pointer to the first byte.
+ * @param count Number of bytes, which must be at least one.
+ * @param code_point A pointer to which to write the code point, or `U+FFFD` if the sequence is invalid.
+ * @param valid A pointer to which to write whether the sequence is valid.
+ * @returns The length of the sequence, or of its longest prefix that could have started a valid sequence if it is invalid.
+ */
+static size_t _string_utf8_decode(const char *data, size_t count, char_t *code_point, bool *valid)
+{
+    const unsigned char lead = (unsigned char) data[0];
+    *valid = false;
+    *code_point = _STRING_UTF8_REPLACEMENT;
+    if (lead < 0x80)
+    {
+        *valid = true;
+        *code_point = lead;
+        return 1;
+    }
+    size_t length;
+    char_t result;
+    // The range of the second byte excludes overlong encodings, surrogates and code points above U+10FFFF.
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    if (lead < 0xC2)
+    {
+        return 1;
+    }
+    else if (lead < 0xE0)
+    {
+        length = 2;
+        result = lead & 0x1F;
+    }
+    else if (lead < 0xF0)
+    {
+        length = 3;
+        result = lead & 0x0F;
+        low = lead == 0xE0 ? 0xA0 : 0x80;
+        high = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if (lead < 0xF5)
+    {
+        length = 4;
+        result = lead & 0x07;
+        low = lead == 0xF0 ? 0x90 : 0x80;
+        high = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+        return 1;
+    }
+    for (size_t i = 1; i < length; i++)
+    {
+        if (i >= count || (unsigned char) data[i] < low || (unsigned char) data[i] > high)
+        {
+            return i;
+        }
+        result = (result << 6) | (data[i] & 0x3F);
+        low = 0x80;
+        high = 0xBF;
+    }
+    *valid = true;
+    *code_point = result;
+    return length;
+}
+
+/**
+ * @brief Determine whether a given string is valid UTF-8: no overlong encodings, no surrogates, nothing above `U+10FFFF`, and no sequence cut short. On x86-64 processors with SSSE3, 16 or, with AVX2, 32 bytes are validated at a time.
+ * @param string A pointer to the string to validate.
+ * @returns A boolean on whether the string is valid UTF-8. An empty string is valid.
+ */
+bool string_is_valid_utf8(const string_t *string)
+{
+    const char *data = string->data;
+    const size_t count = string->count;
+#if STRING_VIEW_SIMD
+    if (count >= 32 && _string_has_avx2())
+    {
+        return _string_is_valid_utf8_avx2(data, count);
+    }
+    if (count >= 16 && _string_has_ssse3())
+    {
+        return _string_is_valid_utf8_ssse3(data, count);
+    }
+#endif // STRING_VIEW_SIMD
+    for (size_t i = 0; i < count;)
+    {
+        char_t code_point;
+        bool valid;
+        i += _string_utf8_decode(data + i, count - i, &code_point, &valid);
+        if (!valid)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Count the code points of a given string of valid UTF-8, which is the number of bytes that are not continuations.
+ * @param string A pointer to the string to count.
+ * @returns The number of code points within the string.
+ */
+size_t string_utf8_count(const string_t *string)
+{
+    const char *data = string->data;
+    const size_t count = string->count;
+    size_t result = 0;
+    size_t i = 0;
+#if STRING_VIEW_SIMD
+    if (_string_has_avx2())
+    {
+        result = _string_utf8_count_avx2(data, count);
+        i = count & ~(size_t) 31;
+    }
+    else
+    {
+        result = _string_utf8_count_sse2(data, count);
+        i = count & ~(size_t) 15;
+    }
+#endif // STRING_VIEW_SIMD
+    for (; i < count; i++)
+    {
+        result += ((unsigned char) data[i] & 0xC0) != 0x80;
+    }
+    return result;
+}
+
+/**
+ * @brief Decode the next code point of a given string of UTF-8 and remove it from the front of the string. An invalid sequence decodes to the replacement charactor `U+FFFD`, and only the longest prefix of it that could have started a valid sequence — at least one byte — is removed.
+ * @param string A pointer to the string to decode.
+ * @param code_point A pointer to which to write the code point.
+ * @returns True if a code point was written, else false once the string is empty.
+ */
+bool string_utf8_next(string_t *string, char_t *code_point)
+{
+    if (string->count == 0)
+    {
+        return false;
+    }
+    size_t length = 1;
+    if ((unsigned char) string->data[0] < 0x80)
+    {
+        *code_point = (unsigned char) string->data[0];
+    }
+    else
+    {
+        bool valid;
+        length = _string_utf8_decode(string->data, string->count, code_point, &valid);
+    }
+    string->data += length;
+    string->count -= length;
+    return true;
 }
 
 /**
@@ -121,10 +121,12 @@ extern "C" {
 #endif
 
 #include <stdlib.h> // NULL, exit
-#include <string.h> // strcmp, strtoull
+#include <string.h> // strcmp
 #include <assert.h> // static_assert
-#include <errno.h> // errorno, ERANGE
-#include <limits.h> // ULLONG_MAX, UINT64_MAX
+#include <limits.h> // UINT64_MAX
+
+#define STRING_VIEW_IMPLEMENTATION
+#include "./collections/string_view.h" // string_t, string_from_literal, string_parse_t, string_to_u64
 
 #define FLAG_CAPACITY 256
 
@@ -301,15 +303,15 @@ static void _flag_scan(int argc, char **argv)
                             exit(1);
                         }
                         char *arg = _flag_shift_args(&argc, &argv);
-                        static_assert(sizeof(unsigned long long int) == sizeof(uint64_t), "The original author designed this for x86_64 machine with the compiler that expects unsigned long long int and uint64_t to be the same thing, so they could use strtoull() function to parse it. Please adjust this code for your case and maybe even send the patch to upstream to make it work on a wider range of environments.");
-                        char *endptr;
-                        unsigned long long int result = strtoull(arg, &endptr, 10);
-                        if (arg == endptr || strcmp(endptr, "\0"))
+                        const string_t text = string_from_literal(arg);
+                        uint64_t result;
+                        const string_parse_t parse = string_to_u64(&text, &result);
+                        if (parse.count == 0 || parse.count != text.count)
                         {
                             fprintf(stderr, "RuntimeError: '%s' is not a valid number.", flag);
                             exit(1);
                         };
-                        if (result == ULLONG_MAX && errno == ERANGE)
+                        if (parse.overflow)
                         {
                             fprintf(stderr, "OverflowError: '%s' is a 64 bit unsigned integer overflow\n", flag);
                             exit(1);
@@ -54,6 +54,36 @@ namespace polutils
                  */
                 std::size_t size() const noexcept;
 
+                /**
+                 * @brief Obtain the number of items the array can hold before being resized.
+                 * @returns The capacity of the array.
+                 */
+                std::size_t capacity() const noexcept;
+
+                /**
+                 * @brief Obtain the contiguous storage of the array. The storage holds `size()` items.
+                 * @returns A mutable pointer to the first item of the array.
+                 */
+                Type *data() const noexcept;
+
+                /**
+                 * @brief Ensure the array can hold at least a given number of items.
+                 * @param capacity Minimum capacity of the array.
+                 * @exception If the array can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void reserve(std::size_t capacity);
+
+                /**
+                 * @brief Remove every item from the array. The capacity is left unchanged.
+                 */
+                void clear() noexcept;
+
+                /**
+                 * @brief Exchange the storage of two arrays.
+                 * @param other Array with which to exchange storage.
+                 */
+                void swap(array_t &other) noexcept;
+
                 /**
                  * @brief Determine if the collection is empty.
                  * @returns True if the collection is determined to be empty, else false.
@@ -100,9 +130,10 @@ namespace polutils
 
 #endif // ARRAY_HPP
 
-#ifdef ARRAY_IMPLEMENTATION
+#if defined(ARRAY_IMPLEMENTATION) && !defined(ARRAY_IMPLEMENTED)
+#define ARRAY_IMPLEMENTED
 
-#include <cstdlib> // std::calloc, std::free, nullptr
+#include <cstdlib> // std::calloc, std::realloc, std::free, nullptr
 
 #define EXCEPTIONS_IMPLEMENTATION
 #include "../exceptions.hpp"
@@ -197,7 +228,6 @@ namespace polutils
          * @brief Remove an element from the array at a given index. This method is marked as virtual and can be overridden.
          * @param index Index at which the element within the array is located.
          * @exception If the given index is greater than the size of the array, an `IndexError` is thrown.
-         * @exception If the array's memory can not be reallocated, an `AllocationError` is thrown.
          */
         template <typename Type>
         void array_t<Type>::remove(std::size_t index)
@@ -213,13 +243,6 @@ namespace polutils
                 __items[i] = __items[i + 1];
             }
             __size--;
-            Type *temp = static_cast<Type*>(std::realloc(__items, __size * sizeof(Type)));
-            if (temp == nullptr) {
-                throw AllocationError("Can not resize array.");
-            }
-            __items = temp;
-            std::free(temp);
-            temp = nullptr;
         }
 
         /**
@@ -232,6 +255,74 @@ namespace polutils
             return __size;
         }
 
+        /**
+         * @brief Obtain the number of items the array can hold before being resized.
+         * @returns The capacity of the array.
+         */
+        template <typename Type>
+        std::size_t array_t<Type>::capacity() const noexcept
+        {
+            return __capacity;
+        }
+
+        /**
+         * @brief Obtain the contiguous storage of the array. The storage holds `size()` items.
+         * @returns A mutable pointer to the first item of the array.
+         */
+        template <typename Type>
+        Type *array_t<Type>::data() const noexcept
+        {
+            return __items;
+        }
+
+        /**
+         * @brief Ensure the array can hold at least a given number of items.
+         * @param capacity Minimum capacity of the array.
+         * @exception If the array can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void array_t<Type>::reserve(std::size_t capacity)
+        {
+            if (capacity <= __capacity)
+            {
+                return;
+            }
+            Type *temp = static_cast<Type *>(std::realloc(__items, sizeof(Type) * capacity));
+            if (nullptr == temp)
+            {
+                throw AllocationError("Can not resize array.");
+            }
+            __items = temp;
+            __capacity = capacity;
+        }
+
+        /**
+         * @brief Remove every item from the array. The capacity is left unchanged.
+         */
+        template <typename Type>
+        void array_t<Type>::clear() noexcept
+        {
+            __size = 0;
+        }
+
+        /**
+         * @brief Exchange the storage of two arrays.
+         * @param other Array with which to exchange storage.
+         */
+        template <typename Type>
+        void array_t<Type>::swap(array_t &other) noexcept
+        {
+            Type *items = __items;
+            std::size_t size = __size;
+            std::size_t capacity = __capacity;
+            __items = other.__items;
+            __size = other.__size;
+            __capacity = other.__capacity;
+            other.__items = items;
+            other.__size = size;
+            other.__capacity = capacity;
+        }
+
         /**
          * @brief Determine if the collection is empty.
          * @returns True if the collection is determined to be empty, else false.
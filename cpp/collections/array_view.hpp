@@ -0,0 +1,442 @@
+#ifndef ARRAY_VIEW_HPP
+#define ARRAY_VIEW_HPP
+
+#include <cstddef> // std::size_t
+#include <type_traits> // std::enable_if, std::is_convertible, std::is_base_of, std::remove_cv, std::remove_pointer
+#include <utility> // std::declval
+
+#include "array.hpp" // array_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Determine whether a pointer to items of one type can be viewed as a pointer to items of another. Only qualification conversions are allowed, so a view never reinterprets a derived type as its base.
+         */
+        template <typename From, typename To>
+        using __array_view_viewable = std::is_convertible<From (*)[], To (*)[]>;
+
+        /**
+         * @brief Determine whether a contiguous container, exposing `data` and `size`, can be viewed as items of a given type. Arrays are excluded, since they expose mutable storage even when constant.
+         */
+        template <typename Container, typename Type, typename = void>
+        struct __array_view_contiguous : std::false_type {};
+
+        template <typename Container, typename Type>
+        struct __array_view_contiguous<Container, Type, decltype((void)std::declval<Container &>().size(), (void)std::declval<Container &>().data())>
+            : std::integral_constant<bool,
+                !std::is_base_of<array_t<typename std::remove_cv<Type>::type>, typename std::remove_cv<Container>::type>::value &&
+                __array_view_viewable<typename std::remove_pointer<decltype(std::declval<Container &>().data())>::type, Type>::value> {};
+
+        /**
+         * @brief Non-owning view of a contiguous range of items. A view is two words wide and cheap to copy, so it is passed by value. A view of `const Type` can only read its items, and a view of `Type` converts to it implicitly.
+         */
+        template <typename Type>
+        struct array_view_t
+        {
+            public:
+                using value_type = typename std::remove_cv<Type>::type;
+                using iterator = Type *;
+
+                /**
+                 * @brief Construct a new empty view.
+                 */
+                constexpr array_view_t(void) noexcept;
+
+                /**
+                 * @brief Construct a new view of a range of items.
+                 * @param items Pointer to the first item.
+                 * @param count Number of items within the range.
+                 */
+                constexpr array_view_t(Type *items, std::size_t count) noexcept;
+
+                /**
+                 * @brief Construct a new view of the items between two pointers.
+                 * @param first Pointer to the first item.
+                 * @param last Pointer past the last item.
+                 */
+                constexpr array_view_t(Type *first, Type *last) noexcept;
+
+                /**
+                 * @brief Construct a new view of every item of a built-in array.
+                 * @param items Built-in array to view.
+                 */
+                template <std::size_t Count>
+                constexpr array_view_t(Type (&items)[Count]) noexcept;
+
+                /**
+                 * @brief Construct a new view of every item of an array, including a dynamic array.
+                 * @param array Array to view.
+                 */
+                template <typename Other, typename std::enable_if<__array_view_viewable<Other, Type>::value, int>::type = 0>
+                array_view_t(array_t<Other> &array) noexcept;
+
+                /**
+                 * @brief Construct a new view of every item of a constant array, including a dynamic array. The view must be of constant items.
+                 * @param array Array to view.
+                 */
+                template <typename Other, typename std::enable_if<__array_view_viewable<const Other, Type>::value, int>::type = 0>
+                array_view_t(const array_t<Other> &array) noexcept;
+
+                /**
+                 * @brief Construct a new view of every item of a contiguous container, such as `std::vector`, exposing `data` and `size`.
+                 * @param container Container to view.
+                 */
+                template <typename Container, typename std::enable_if<__array_view_contiguous<Container, Type>::value, int>::type = 0>
+                array_view_t(Container &container) noexcept;
+
+                /**
+                 * @brief Construct a view of constant items from a view of mutable items.
+                 * @param other View to convert.
+                 */
+                template <typename Other, typename std::enable_if<__array_view_viewable<Other, Type>::value, int>::type = 0>
+                constexpr array_view_t(const array_view_t<Other> &other) noexcept;
+
+                /**
+                 * @brief Obtain a pointer to an item at a given index within the view.
+                 * @param index Index at which the item within the view is located.
+                 * @returns A pointer to the item.
+                 * @exception If the given index is greater than or equal to the size of the view, an `IndexError` is thrown.
+                 */
+                Type *at(std::size_t index) const;
+
+                /**
+                 * @brief Obtain a reference to an item at a given index within the view. The index is not checked.
+                 * @param index Index at which the item within the view is located.
+                 * @returns A reference to the item.
+                 */
+                constexpr Type &operator[](std::size_t index) const noexcept;
+
+                /**
+                 * @brief Obtain a view of a given number of items starting at a given offset.
+                 * @param offset Index of the first item of the subview.
+                 * @param count Number of items within the subview.
+                 * @returns The subview.
+                 * @exception If the range extends past the end of the view, an `OutOfRangeError` is thrown.
+                 */
+                array_view_t subview(std::size_t offset, std::size_t count) const;
+
+                /**
+                 * @brief Obtain a view of every item from a given offset to the end.
+                 * @param offset Index of the first item of the subview.
+                 * @returns The subview.
+                 * @exception If the offset is greater than the size of the view, an `OutOfRangeError` is thrown.
+                 */
+                array_view_t subview(std::size_t offset) const;
+
+                /**
+                 * @brief Obtain a view of the first given number of items.
+                 * @param count Number of items within the subview.
+                 * @returns The subview.
+                 * @exception If the count is greater than the size of the view, an `OutOfRangeError` is thrown.
+                 */
+                array_view_t first(std::size_t count) const;
+
+                /**
+                 * @brief Obtain a view of the last given number of items.
+                 * @param count Number of items within the subview.
+                 * @returns The subview.
+                 * @exception If the count is greater than the size of the view, an `OutOfRangeError` is thrown.
+                 */
+                array_view_t last(std::size_t count) const;
+
+                /**
+                 * @brief Split the view into a given number of parts, whose sizes differ by at most one, and obtain one of them. The parts are in order and cover the view without overlapping, so they can be handed to separate threads.
+                 * @param parts Number of parts into which to split the view.
+                 * @param part Index of the part to obtain.
+                 * @returns The part.
+                 * @exception If the number of parts is zero or the part is not less than it, a `ValueError` is thrown.
+                 */
+                array_view_t partition(std::size_t parts, std::size_t part) const;
+
+                /**
+                 * @brief Obtain a pointer to the first item of the view.
+                 * @returns A pointer to the first item, which may be null if the view is empty.
+                 */
+                constexpr Type *data(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of items within the view.
+                 * @returns The size of the view.
+                 */
+                constexpr std::size_t size(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of bytes spanned by the view.
+                 * @returns The size of the view in bytes.
+                 */
+                constexpr std::size_t size_in_bytes(void) const noexcept;
+
+                /**
+                 * @brief Determine if the view is empty.
+                 * @returns True if the view is determined to be empty, else false.
+                 */
+                constexpr bool is_empty(void) const noexcept;
+
+                /**
+                 * @brief Obtain an iterator to the first item of the view.
+                 * @returns A pointer to the first item.
+                 */
+                constexpr iterator begin(void) const noexcept;
+
+                /**
+                 * @brief Obtain an iterator past the last item of the view.
+                 * @returns A pointer past the last item.
+                 */
+                constexpr iterator end(void) const noexcept;
+
+            protected:
+                Type *__items;
+                std::size_t __size;
+        };
+    }
+}
+
+#endif // ARRAY_VIEW_HPP
+
+#if defined(ARRAY_VIEW_IMPLEMENTATION) && !defined(ARRAY_VIEW_IMPLEMENTED)
+#define ARRAY_VIEW_IMPLEMENTED
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty view.
+         */
+        template <typename Type>
+        constexpr array_view_t<Type>::array_view_t(void) noexcept : __items(nullptr), __size(0) {}
+
+        /**
+         * @brief Construct a new view of a range of items.
+         * @param items Pointer to the first item.
+         * @param count Number of items within the range.
+         */
+        template <typename Type>
+        constexpr array_view_t<Type>::array_view_t(Type *items, std::size_t count) noexcept : __items(items), __size(count) {}
+
+        /**
+         * @brief Construct a new view of the items between two pointers.
+         * @param first Pointer to the first item.
+         * @param last Pointer past the last item.
+         */
+        template <typename Type>
+        constexpr array_view_t<Type>::array_view_t(Type *first, Type *last) noexcept : __items(first), __size(static_cast<std::size_t>(last - first)) {}
+
+        /**
+         * @brief Construct a new view of every item of a built-in array.
+         * @param items Built-in array to view.
+         */
+        template <typename Type>
+        template <std::size_t Count>
+        constexpr array_view_t<Type>::array_view_t(Type (&items)[Count]) noexcept : __items(items), __size(Count) {}
+
+        /**
+         * @brief Construct a new view of every item of an array, including a dynamic array.
+         * @param array Array to view.
+         */
+        template <typename Type>
+        template <typename Other, typename std::enable_if<__array_view_viewable<Other, Type>::value, int>::type>
+        array_view_t<Type>::array_view_t(array_t<Other> &array) noexcept : __items(array.data()), __size(array.size()) {}
+
+        /**
+         * @brief Construct a new view of every item of a constant array, including a dynamic array. The view must be of constant items.
+         * @param array Array to view.
+         */
+        template <typename Type>
+        template <typename Other, typename std::enable_if<__array_view_viewable<const Other, Type>::value, int>::type>
+        array_view_t<Type>::array_view_t(const array_t<Other> &array) noexcept : __items(array.data()), __size(array.size()) {}
+
+        /**
+         * @brief Construct a new view of every item of a contiguous container, such as `std::vector`, exposing `data` and `size`.
+         * @param container Container to view.
+         */
+        template <typename Type>
+        template <typename Container, typename std::enable_if<__array_view_contiguous<Container, Type>::value, int>::type>
+        array_view_t<Type>::array_view_t(Container &container) noexcept : __items(container.data()), __size(container.size()) {}
+
+        /**
+         * @brief Construct a view of constant items from a view of mutable items.
+         * @param other View to convert.
+         */
+        template <typename Type>
+        template <typename Other, typename std::enable_if<__array_view_viewable<Other, Type>::value, int>::type>
+        constexpr array_view_t<Type>::array_view_t(const array_view_t<Other> &other) noexcept : __items(other.data()), __size(other.size()) {}
+
+        /**
+         * @brief Obtain a pointer to an item at a given index within the view.
+         * @param index Index at which the item within the view is located.
+         * @returns A pointer to the item.
+         * @exception If the given index is greater than or equal to the size of the view, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        Type *array_view_t<Type>::at(std::size_t index) const
+        {
+            if (index >= __size)
+            {
+                throw IndexError("Can not access item %zu of a view of size %zu.", index, __size);
+            }
+            return __items + index;
+        }
+
+        /**
+         * @brief Obtain a reference to an item at a given index within the view. The index is not checked.
+         * @param index Index at which the item within the view is located.
+         * @returns A reference to the item.
+         */
+        template <typename Type>
+        constexpr Type &array_view_t<Type>::operator[](std::size_t index) const noexcept
+        {
+            return __items[index];
+        }
+
+        /**
+         * @brief Obtain a view of a given number of items starting at a given offset.
+         * @param offset Index of the first item of the subview.
+         * @param count Number of items within the subview.
+         * @returns The subview.
+         * @exception If the range extends past the end of the view, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        array_view_t<Type> array_view_t<Type>::subview(std::size_t offset, std::size_t count) const
+        {
+            // Written so that neither side can overflow, whatever the offset and count.
+            if (offset > __size || count > __size - offset)
+            {
+                throw OutOfRangeError("Can not view %zu items from offset %zu of a view of size %zu.", count, offset, __size);
+            }
+            return array_view_t(__items + offset, count);
+        }
+
+        /**
+         * @brief Obtain a view of every item from a given offset to the end.
+         * @param offset Index of the first item of the subview.
+         * @returns The subview.
+         * @exception If the offset is greater than the size of the view, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        array_view_t<Type> array_view_t<Type>::subview(std::size_t offset) const
+        {
+            if (offset > __size)
+            {
+                throw OutOfRangeError("Can not view from offset %zu of a view of size %zu.", offset, __size);
+            }
+            return array_view_t(__items + offset, __size - offset);
+        }
+
+        /**
+         * @brief Obtain a view of the first given number of items.
+         * @param count Number of items within the subview.
+         * @returns The subview.
+         * @exception If the count is greater than the size of the view, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        array_view_t<Type> array_view_t<Type>::first(std::size_t count) const
+        {
+            return subview(0, count);
+        }
+
+        /**
+         * @brief Obtain a view of the last given number of items.
+         * @param count Number of items within the subview.
+         * @returns The subview.
+         * @exception If the count is greater than the size of the view, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        array_view_t<Type> array_view_t<Type>::last(std::size_t count) const
+        {
+            if (count > __size)
+            {
+                throw OutOfRangeError("Can not view the last %zu items of a view of size %zu.", count, __size);
+            }
+            return array_view_t(__items + (__size - count), count);
+        }
+
+        /**
+         * @brief Split the view into a given number of parts, whose sizes differ by at most one, and obtain one of them. The parts are in order and cover the view without overlapping, so they can be handed to separate threads.
+         * @param parts Number of parts into which to split the view.
+         * @param part Index of the part to obtain.
+         * @returns The part.
+         * @exception If the number of parts is zero or the part is not less than it, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        array_view_t<Type> array_view_t<Type>::partition(std::size_t parts, std::size_t part) const
+        {
+            if (part >= parts)
+            {
+                throw ValueError("Can not obtain part %zu of a view split into %zu parts.", part, parts);
+            }
+            // The first `remainder` parts hold one extra item each.
+            const std::size_t quotient = __size / parts;
+            const std::size_t remainder = __size % parts;
+            const std::size_t offset = part * quotient + (part < remainder ? part : remainder);
+            return array_view_t(__items + offset, quotient + (part < remainder ? 1 : 0));
+        }
+
+        /**
+         * @brief Obtain a pointer to the first item of the view.
+         * @returns A pointer to the first item, which may be null if the view is empty.
+         */
+        template <typename Type>
+        constexpr Type *array_view_t<Type>::data(void) const noexcept
+        {
+            return __items;
+        }
+
+        /**
+         * @brief Obtain the number of items within the view.
+         * @returns The size of the view.
+         */
+        template <typename Type>
+        constexpr std::size_t array_view_t<Type>::size(void) const noexcept
+        {
+            return __size;
+        }
+
+        /**
+         * @brief Obtain the number of bytes spanned by the view.
+         * @returns The size of the view in bytes.
+         */
+        template <typename Type>
+        constexpr std::size_t array_view_t<Type>::size_in_bytes(void) const noexcept
+        {
+            return __size * sizeof(Type);
+        }
+
+        /**
+         * @brief Determine if the view is empty.
+         * @returns True if the view is determined to be empty, else false.
+         */
+        template <typename Type>
+        constexpr bool array_view_t<Type>::is_empty(void) const noexcept
+        {
+            return __size == 0;
+        }
+
+        /**
+         * @brief Obtain an iterator to the first item of the view.
+         * @returns A pointer to the first item.
+         */
+        template <typename Type>
+        constexpr typename array_view_t<Type>::iterator array_view_t<Type>::begin(void) const noexcept
+        {
+            return __items;
+        }
+
+        /**
+         * @brief Obtain an iterator past the last item of the view.
+         * @returns A pointer past the last item.
+         */
+        template <typename Type>
+        constexpr typename array_view_t<Type>::iterator array_view_t<Type>::end(void) const noexcept
+        {
+            return __items + __size;
+        }
+    }
+}
+
+#endif // ARRAY_VIEW_IMPLEMENTATION
@@ -0,0 +1,1020 @@
+#ifndef BITMAP_HPP
+#define BITMAP_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint16_t, std::uint32_t, std::uint64_t
+#include <vector> // std::vector
+
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Compressed set of 32-bit unsigned integers. The set is partitioned by the upper 16 bits of each value into containers; each container stores the lower 16 bits as either a sorted array, an uncompressed bitmap, or a list of runs — whichever is the most compact.
+         */
+        struct bitmap_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Construct a new empty bitmap.
+                 */
+                bitmap_t(void) noexcept;
+
+                /**
+                 * @brief Add a value to the bitmap. If the value is already present, the bitmap is left unchanged.
+                 * @param value Value to add.
+                 */
+                void add(std::uint32_t value);
+
+                /**
+                 * @brief Add a range of values to the bitmap.
+                 * @param values Pointer to the first value to add.
+                 * @param count Number of values to add.
+                 */
+                void add(const std::uint32_t *values, std::size_t count);
+
+                /**
+                 * @brief Remove a value from the bitmap.
+                 * @param value Value to remove.
+                 * @exception If the value is not present within the bitmap, a `ValueError` is thrown.
+                 */
+                void remove(std::uint32_t value);
+
+                /**
+                 * @brief Determine if a value is present within the bitmap.
+                 * @param value Value to search for.
+                 * @returns True if the value is present within the bitmap, else false.
+                 */
+                bool contains(std::uint32_t value) const noexcept;
+
+                /**
+                 * @brief Convert every container to its most compact representation, including runs.
+                 */
+                void optimize(void);
+
+                /**
+                 * @brief Call a given function for every value within the bitmap in ascending order.
+                 * @param function Callable taking a single `std::uint32_t`.
+                 */
+                template <typename Function>
+                void for_each(Function function) const;
+
+                /**
+                 * @brief Store the union of this bitmap and another bitmap within this bitmap.
+                 * @param other Bitmap from which to take the union.
+                 * @returns A reference to this bitmap.
+                 */
+                bitmap_t &operator|=(const bitmap_t &other);
+
+                /**
+                 * @brief Store the intersection of this bitmap and another bitmap within this bitmap.
+                 * @param other Bitmap from which to take the intersection.
+                 * @returns A reference to this bitmap.
+                 */
+                bitmap_t &operator&=(const bitmap_t &other);
+
+                /**
+                 * @brief Obtain the union of two bitmaps.
+                 * @param other Bitmap from which to take the union.
+                 * @returns A new bitmap containing every value in either bitmap.
+                 */
+                bitmap_t operator|(const bitmap_t &other) const;
+
+                /**
+                 * @brief Obtain the intersection of two bitmaps.
+                 * @param other Bitmap from which to take the intersection.
+                 * @returns A new bitmap containing every value present in both bitmaps.
+                 */
+                bitmap_t operator&(const bitmap_t &other) const;
+
+                /**
+                 * @brief Determine if two bitmaps contain exactly the same values.
+                 * @param other Bitmap against which to compare.
+                 * @returns True if both bitmaps contain the same values, else false.
+                 */
+                bool operator==(const bitmap_t &other) const;
+
+                /**
+                 * @brief Obtain the number of values within the bitmap.
+                 * @returns The cardinality of the bitmap.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the bitmap is empty.
+                 * @returns True if the bitmap contains no values, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the bitmap is full.
+                 * @returns True if every 32-bit value is present within the bitmap, else false.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Obtain an estimate of the memory used by the values of the bitmap.
+                 * @returns The number of bytes used by the containers of the bitmap.
+                 */
+                std::size_t size_in_bytes(void) const noexcept;
+
+            protected:
+                /**
+                 * @brief Representation of the values stored within a container.
+                 */
+                enum class kind_t
+                {
+                    ARRAY,
+                    BITMAP,
+                    RUN,
+                };
+
+                /**
+                 * @brief Inclusive run of consecutive values — `start` up to and including `start + length`.
+                 */
+                struct run_t
+                {
+                    std::uint16_t start;
+                    std::uint16_t length;
+                };
+
+                /**
+                 * @brief Values that share the same upper 16 bits.
+                 */
+                struct container_t
+                {
+                    kind_t kind;
+                    std::uint32_t cardinality;
+                    std::vector<std::uint16_t> array;
+                    std::vector<std::uint64_t> words;
+                    std::vector<run_t> runs;
+                };
+
+                /**
+                 * @brief Find the position of a given key.
+                 * @param key Upper 16 bits of a value.
+                 * @returns The index of the first key that is not less than the given key.
+                 */
+                std::size_t _lower_bound(std::uint16_t key) const noexcept;
+
+                /**
+                 * @brief Remove every empty container.
+                 */
+                void _compact(void) noexcept;
+
+            protected:
+                std::vector<std::uint16_t> __keys;
+                std::vector<container_t> __containers;
+        };
+    }
+}
+
+#endif // BITMAP_HPP
+
+#if defined(BITMAP_IMPLEMENTATION) && !defined(BITMAP_IMPLEMENTED)
+#define BITMAP_IMPLEMENTED
+
+#include <algorithm> // std::lower_bound, std::upper_bound, std::set_union, std::set_intersection, std::sort, std::unique
+#include <iterator> // std::back_inserter
+#include <utility> // std::move
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace
+{
+    /**
+     * @brief Number of 64-bit words within an uncompressed container.
+     */
+    constexpr std::size_t __BITMAP_WORDS = 1024;
+
+    /**
+     * @brief Largest cardinality of an array container. Past this an uncompressed container is smaller.
+     */
+    constexpr std::uint32_t __BITMAP_ARRAY_LIMIT = 4096;
+
+    /**
+     * @brief Number of values — and of containers — sharing the same upper 16 bits.
+     */
+    constexpr std::uint32_t __BITMAP_CONTAINER_VALUES = 65536;
+
+    /**
+     * @brief Count the set bits of a word.
+     * @param word Word from which to count.
+     * @returns The number of set bits.
+     */
+    inline std::uint32_t __bitmap_popcount(std::uint64_t word) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::uint32_t>(__builtin_popcountll(word));
+    #else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<std::uint32_t>((word * 0x0101010101010101ULL) >> 56);
+    #endif
+    }
+
+    /**
+     * @brief Count the trailing zero bits of a non-zero word.
+     * @param word Word from which to count.
+     * @returns The index of the lowest set bit.
+     */
+    inline std::uint32_t __bitmap_ctz(std::uint64_t word) noexcept
+    {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::uint32_t>(__builtin_ctzll(word));
+    #else
+        std::uint32_t count = 0;
+        while (!(word & 1))
+        {
+            word >>= 1;
+            count++;
+        }
+        return count;
+    #endif
+    }
+
+    /**
+     * @brief Count the set bits of an uncompressed container. Written as a flat loop so that it vectorizes.
+     * @param words Words of the container.
+     * @returns The number of set bits.
+     */
+    inline std::uint32_t __bitmap_cardinality(const std::uint64_t *words) noexcept
+    {
+        std::uint32_t count = 0;
+        for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+        {
+            count += __bitmap_popcount(words[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Set every bit within an inclusive range.
+     * @param words Words of the container.
+     * @param start First bit to set.
+     * @param end Last bit to set.
+     */
+    inline void __bitmap_set_range(std::uint64_t *words, std::uint32_t start, std::uint32_t end) noexcept
+    {
+        std::uint32_t first = start >> 6;
+        std::uint32_t last = end >> 6;
+        std::uint64_t first_mask = ~0ULL << (start & 63);
+        std::uint64_t last_mask = ~0ULL >> (63 - (end & 63));
+        if (first == last)
+        {
+            words[first] |= first_mask & last_mask;
+            return;
+        }
+        words[first] |= first_mask;
+        for (std::uint32_t i = first + 1; i < last; ++i)
+        {
+            words[i] = ~0ULL;
+        }
+        words[last] |= last_mask;
+    }
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        namespace
+        {
+            /**
+             * @brief Access to the protected container representation of the bitmap for the internal kernels.
+             */
+            struct __bitmap_kernels_t : public bitmap_t
+            {
+                using bitmap_t::kind_t;
+                using bitmap_t::run_t;
+                using bitmap_t::container_t;
+
+                /**
+                 * @brief Expand a container into an uncompressed container.
+                 * @param container Container to expand.
+                 * @param words Destination of `__BITMAP_WORDS` zeroed words.
+                 */
+                static void expand(const container_t &container, std::uint64_t *words) noexcept
+                {
+                    switch (container.kind)
+                    {
+                        case kind_t::ARRAY:
+                        {
+                            for (std::uint16_t value : container.array)
+                            {
+                                words[value >> 6] |= 1ULL << (value & 63);
+                            }
+                        } break;
+                        case kind_t::BITMAP:
+                        {
+                            std::copy(container.words.begin(), container.words.end(), words);
+                        } break;
+                        case kind_t::RUN:
+                        {
+                            for (const run_t &run : container.runs)
+                            {
+                                __bitmap_set_range(words, run.start, static_cast<std::uint32_t>(run.start) + run.length);
+                            }
+                        } break;
+                    }
+                }
+
+                /**
+                 * @brief Convert an uncompressed container into an array container if it is small enough.
+                 * @param container Container to normalize. Its cardinality must be up to date.
+                 */
+                static void normalize(container_t &container)
+                {
+                    if (container.kind != kind_t::BITMAP || container.cardinality > __BITMAP_ARRAY_LIMIT)
+                    {
+                        return;
+                    }
+                    container.array.clear();
+                    container.array.reserve(container.cardinality);
+                    for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+                    {
+                        std::uint64_t word = container.words[i];
+                        while (word)
+                        {
+                            container.array.push_back(static_cast<std::uint16_t>((i << 6) + __bitmap_ctz(word)));
+                            word &= word - 1;
+                        }
+                    }
+                    container.words.clear();
+                    container.words.shrink_to_fit();
+                    container.kind = kind_t::ARRAY;
+                }
+
+                /**
+                 * @brief Convert a container of any kind into an uncompressed container.
+                 * @param container Container to convert.
+                 */
+                static void to_bitmap(container_t &container)
+                {
+                    if (container.kind == kind_t::BITMAP)
+                    {
+                        return;
+                    }
+                    std::vector<std::uint64_t> words(__BITMAP_WORDS, 0);
+                    expand(container, words.data());
+                    container.words.swap(words);
+                    container.array.clear();
+                    container.array.shrink_to_fit();
+                    container.runs.clear();
+                    container.runs.shrink_to_fit();
+                    container.kind = kind_t::BITMAP;
+                }
+
+                /**
+                 * @brief Convert a run container into either an array or uncompressed container.
+                 * @param container Container to convert.
+                 */
+                static void unrun(container_t &container)
+                {
+                    if (container.kind != kind_t::RUN)
+                    {
+                        return;
+                    }
+                    to_bitmap(container);
+                    normalize(container);
+                }
+
+                /**
+                 * @brief Add the given lower 16 bits of a value to a run container, extending or merging the neighbouring runs. If the runs grow larger than the equivalent array or uncompressed container, the container is converted into it.
+                 * @param container Run container to which to add.
+                 * @param value Lower 16 bits of a value.
+                 */
+                static void add_to_runs(container_t &container, std::uint16_t value)
+                {
+                    std::vector<run_t> &runs = container.runs;
+                    auto next = std::upper_bound(runs.begin(), runs.end(), value, [](std::uint16_t v, const run_t &r)
+                    {
+                        return v < r.start;
+                    });
+                    const bool has_previous = next != runs.begin();
+                    if (has_previous && static_cast<std::uint32_t>(value) <= static_cast<std::uint32_t>((next - 1)->start) + (next - 1)->length)
+                    {
+                        return;
+                    }
+                    const bool joins_previous = has_previous && static_cast<std::uint32_t>(value) == static_cast<std::uint32_t>((next - 1)->start) + (next - 1)->length + 1;
+                    const bool joins_next = next != runs.end() && static_cast<std::uint32_t>(value) + 1 == next->start;
+                    container.cardinality++;
+                    if (joins_previous && joins_next)
+                    {
+                        (next - 1)->length = static_cast<std::uint16_t>((next - 1)->length + next->length + 2);
+                        runs.erase(next);
+                        return;
+                    }
+                    if (joins_previous)
+                    {
+                        (next - 1)->length++;
+                        return;
+                    }
+                    if (joins_next)
+                    {
+                        next->start--;
+                        next->length++;
+                        return;
+                    }
+                    runs.insert(next, run_t{value, 0});
+                    const std::size_t unrun_bytes = container.cardinality > __BITMAP_ARRAY_LIMIT ? __BITMAP_WORDS * sizeof(std::uint64_t) : container.cardinality * sizeof(std::uint16_t);
+                    if (runs.size() * sizeof(run_t) > unrun_bytes)
+                    {
+                        unrun(container);
+                    }
+                }
+
+                /**
+                 * @brief Determine if a container contains the given lower 16 bits of a value.
+                 * @param container Container to search.
+                 * @param value Lower 16 bits of a value.
+                 * @returns True if the value is present, else false.
+                 */
+                static bool contains(const container_t &container, std::uint16_t value) noexcept
+                {
+                    switch (container.kind)
+                    {
+                        case kind_t::ARRAY:
+                        {
+                            return std::binary_search(container.array.begin(), container.array.end(), value);
+                        }
+                        case kind_t::BITMAP:
+                        {
+                            return (container.words[value >> 6] >> (value & 63)) & 1;
+                        }
+                        case kind_t::RUN:
+                        {
+                            auto run = std::upper_bound(container.runs.begin(), container.runs.end(), value, [](std::uint16_t v, const run_t &r)
+                            {
+                                return v < r.start;
+                            });
+                            if (run == container.runs.begin())
+                            {
+                                return false;
+                            }
+                            --run;
+                            return static_cast<std::uint32_t>(value) <= static_cast<std::uint32_t>(run->start) + run->length;
+                        }
+                    }
+                    return false;
+                }
+
+                /**
+                 * @brief Store the union of two containers within the first.
+                 * @param destination Container in which to store the union.
+                 * @param source Container from which to take the union.
+                 */
+                static void unite(container_t &destination, const container_t &source)
+                {
+                    if (destination.kind == kind_t::ARRAY && source.kind == kind_t::ARRAY && destination.cardinality + source.cardinality <= __BITMAP_ARRAY_LIMIT)
+                    {
+                        std::vector<std::uint16_t> result;
+                        result.reserve(destination.cardinality + source.cardinality);
+                        std::set_union(destination.array.begin(), destination.array.end(), source.array.begin(), source.array.end(), std::back_inserter(result));
+                        destination.array.swap(result);
+                        destination.cardinality = static_cast<std::uint32_t>(destination.array.size());
+                        return;
+                    }
+                    to_bitmap(destination);
+                    if (source.kind == kind_t::BITMAP)
+                    {
+                        std::uint64_t *words = destination.words.data();
+                        const std::uint64_t *other = source.words.data();
+                        for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+                        {
+                            words[i] |= other[i];
+                        }
+                    }
+                    else
+                    {
+                        expand(source, destination.words.data());
+                    }
+                    destination.cardinality = __bitmap_cardinality(destination.words.data());
+                    normalize(destination);
+                }
+
+                /**
+                 * @brief Store the intersection of two containers within the first.
+                 * @param destination Container in which to store the intersection.
+                 * @param source Container from which to take the intersection.
+                 */
+                static void intersect(container_t &destination, const container_t &source)
+                {
+                    if (destination.kind == kind_t::ARRAY && source.kind == kind_t::ARRAY)
+                    {
+                        std::vector<std::uint16_t> result;
+                        result.reserve(std::min(destination.cardinality, source.cardinality));
+                        std::set_intersection(destination.array.begin(), destination.array.end(), source.array.begin(), source.array.end(), std::back_inserter(result));
+                        destination.array.swap(result);
+                        destination.cardinality = static_cast<std::uint32_t>(destination.array.size());
+                        return;
+                    }
+                    if (destination.kind == kind_t::ARRAY || source.kind == kind_t::ARRAY)
+                    {
+                        // Probe the smaller array against the other container instead of expanding it.
+                        const container_t &array = destination.kind == kind_t::ARRAY ? destination : source;
+                        const container_t &other = destination.kind == kind_t::ARRAY ? source : destination;
+                        std::vector<std::uint16_t> result;
+                        result.reserve(array.cardinality);
+                        for (std::uint16_t value : array.array)
+                        {
+                            if (contains(other, value))
+                            {
+                                result.push_back(value);
+                            }
+                        }
+                        destination.kind = kind_t::ARRAY;
+                        destination.array.swap(result);
+                        destination.words.clear();
+                        destination.words.shrink_to_fit();
+                        destination.runs.clear();
+                        destination.runs.shrink_to_fit();
+                        destination.cardinality = static_cast<std::uint32_t>(destination.array.size());
+                        return;
+                    }
+                    to_bitmap(destination);
+                    std::uint64_t *words = destination.words.data();
+                    if (source.kind == kind_t::BITMAP)
+                    {
+                        const std::uint64_t *other = source.words.data();
+                        for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+                        {
+                            words[i] &= other[i];
+                        }
+                    }
+                    else
+                    {
+                        std::vector<std::uint64_t> other(__BITMAP_WORDS, 0);
+                        expand(source, other.data());
+                        for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+                        {
+                            words[i] &= other[i];
+                        }
+                    }
+                    destination.cardinality = __bitmap_cardinality(words);
+                    normalize(destination);
+                }
+
+                /**
+                 * @brief Convert a container into its most compact representation.
+                 * @param container Container to optimize.
+                 */
+                static void optimize(container_t &container)
+                {
+                    unrun(container);
+                    std::vector<run_t> runs;
+                    std::uint32_t previous = 0;
+                    bool open = false;
+                    auto push = [&](std::uint32_t value)
+                    {
+                        if (open && value == previous + 1)
+                        {
+                            runs.back().length++;
+                        }
+                        else
+                        {
+                            runs.push_back(run_t{static_cast<std::uint16_t>(value), 0});
+                            open = true;
+                        }
+                        previous = value;
+                    };
+                    if (container.kind == kind_t::ARRAY)
+                    {
+                        for (std::uint16_t value : container.array)
+                        {
+                            push(value);
+                        }
+                    }
+                    else
+                    {
+                        for (std::size_t i = 0; i < __BITMAP_WORDS; ++i)
+                        {
+                            std::uint64_t word = container.words[i];
+                            while (word)
+                            {
+                                push(static_cast<std::uint32_t>((i << 6) + __bitmap_ctz(word)));
+                                word &= word - 1;
+                            }
+                        }
+                    }
+                    const std::size_t run_bytes = runs.size() * sizeof(run_t);
+                    const std::size_t current_bytes = container.kind == kind_t::ARRAY ? container.cardinality * sizeof(std::uint16_t) : __BITMAP_WORDS * sizeof(std::uint64_t);
+                    if (run_bytes >= current_bytes)
+                    {
+                        return;
+                    }
+                    container.kind = kind_t::RUN;
+                    container.runs.swap(runs);
+                    container.array.clear();
+                    container.array.shrink_to_fit();
+                    container.words.clear();
+                    container.words.shrink_to_fit();
+                }
+            };
+        }
+
+        /**
+         * @brief Construct a new empty bitmap.
+         */
+        bitmap_t::bitmap_t(void) noexcept : __keys(), __containers() {}
+
+        /**
+         * @brief Add a value to the bitmap. If the value is already present, the bitmap is left unchanged.
+         * @param value Value to add.
+         */
+        void bitmap_t::add(std::uint32_t value)
+        {
+            using kernels = __bitmap_kernels_t;
+            const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+            const std::uint16_t low = static_cast<std::uint16_t>(value & 0xFFFF);
+            std::size_t index = _lower_bound(key);
+            if (index == __keys.size() || __keys[index] != key)
+            {
+                __keys.insert(__keys.begin() + index, key);
+                __containers.insert(__containers.begin() + index, container_t{kind_t::ARRAY, 0, {}, {}, {}});
+            }
+            container_t &container = __containers[index];
+            if (container.kind == kind_t::RUN)
+            {
+                kernels::add_to_runs(container, low);
+                return;
+            }
+            if (container.kind == kind_t::ARRAY)
+            {
+                auto position = std::lower_bound(container.array.begin(), container.array.end(), low);
+                if (position != container.array.end() && *position == low)
+                {
+                    return;
+                }
+                container.array.insert(position, low);
+                container.cardinality++;
+                if (container.cardinality > __BITMAP_ARRAY_LIMIT)
+                {
+                    kernels::to_bitmap(container);
+                }
+                return;
+            }
+            std::uint64_t &word = container.words[low >> 6];
+            const std::uint64_t mask = 1ULL << (low & 63);
+            container.cardinality += (word & mask) ? 0 : 1;
+            word |= mask;
+        }
+
+        /**
+         * @brief Add a range of values to the bitmap.
+         * @param values Pointer to the first value to add.
+         * @param count Number of values to add.
+         */
+        void bitmap_t::add(const std::uint32_t *values, std::size_t count)
+        {
+            std::vector<std::uint32_t> sorted(values, values + count);
+            std::sort(sorted.begin(), sorted.end());
+            sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+            bitmap_t batch;
+            std::size_t i = 0;
+            while (i < sorted.size())
+            {
+                // Every value sharing a key is gathered into a single container before being merged.
+                const std::uint16_t key = static_cast<std::uint16_t>(sorted[i] >> 16);
+                container_t container{kind_t::ARRAY, 0, {}, {}, {}};
+                while (i < sorted.size() && (sorted[i] >> 16) == key)
+                {
+                    container.array.push_back(static_cast<std::uint16_t>(sorted[i] & 0xFFFF));
+                    i++;
+                }
+                container.cardinality = static_cast<std::uint32_t>(container.array.size());
+                if (container.cardinality > __BITMAP_ARRAY_LIMIT)
+                {
+                    __bitmap_kernels_t::to_bitmap(container);
+                }
+                batch.__keys.push_back(key);
+                batch.__containers.push_back(std::move(container));
+            }
+            *this |= batch;
+        }
+
+        /**
+         * @brief Remove a value from the bitmap.
+         * @param value Value to remove.
+         * @exception If the value is not present within the bitmap, a `ValueError` is thrown.
+         */
+        void bitmap_t::remove(std::uint32_t value)
+        {
+            using kernels = __bitmap_kernels_t;
+            const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+            const std::uint16_t low = static_cast<std::uint16_t>(value & 0xFFFF);
+            std::size_t index = _lower_bound(key);
+            if (index == __keys.size() || __keys[index] != key || !kernels::contains(__containers[index], low))
+            {
+                throw ValueError("Can not remove %u from a bitmap that does not contain it.", value);
+            }
+            container_t &container = __containers[index];
+            kernels::unrun(container);
+            if (container.kind == kind_t::ARRAY)
+            {
+                container.array.erase(std::lower_bound(container.array.begin(), container.array.end(), low));
+            }
+            else
+            {
+                container.words[low >> 6] &= ~(1ULL << (low & 63));
+            }
+            container.cardinality--;
+            kernels::normalize(container);
+            if (container.cardinality == 0)
+            {
+                __keys.erase(__keys.begin() + index);
+                __containers.erase(__containers.begin() + index);
+            }
+        }
+
+        /**
+         * @brief Determine if a value is present within the bitmap.
+         * @param value Value to search for.
+         * @returns True if the value is present within the bitmap, else false.
+         */
+        bool bitmap_t::contains(std::uint32_t value) const noexcept
+        {
+            const std::uint16_t key = static_cast<std::uint16_t>(value >> 16);
+            std::size_t index = _lower_bound(key);
+            if (index == __keys.size() || __keys[index] != key)
+            {
+                return false;
+            }
+            return __bitmap_kernels_t::contains(__containers[index], static_cast<std::uint16_t>(value & 0xFFFF));
+        }
+
+        /**
+         * @brief Convert every container to its most compact representation, including runs.
+         */
+        void bitmap_t::optimize(void)
+        {
+            for (container_t &container : __containers)
+            {
+                __bitmap_kernels_t::optimize(container);
+            }
+        }
+
+        /**
+         * @brief Call a given function for every value within the bitmap in ascending order.
+         * @param function Callable taking a single `std::uint32_t`.
+         */
+        template <typename Function>
+        void bitmap_t::for_each(Function function) const
+        {
+            for (std::size_t i = 0; i < __keys.size(); ++i)
+            {
+                const std::uint32_t high = static_cast<std::uint32_t>(__keys[i]) << 16;
+                const container_t &container = __containers[i];
+                switch (container.kind)
+                {
+                    case kind_t::ARRAY:
+                    {
+                        for (std::uint16_t value : container.array)
+                        {
+                            function(high | value);
+                        }
+                    } break;
+                    case kind_t::BITMAP:
+                    {
+                        for (std::size_t w = 0; w < __BITMAP_WORDS; ++w)
+                        {
+                            std::uint64_t word = container.words[w];
+                            while (word)
+                            {
+                                function(high | static_cast<std::uint32_t>((w << 6) + __bitmap_ctz(word)));
+                                word &= word - 1;
+                            }
+                        }
+                    } break;
+                    case kind_t::RUN:
+                    {
+                        for (const run_t &run : container.runs)
+                        {
+                            const std::uint32_t end = static_cast<std::uint32_t>(run.start) + run.length;
+                            for (std::uint32_t value = run.start; value <= end; ++value)
+                            {
+                                function(high | value);
+                            }
+                        }
+                    } break;
+                }
+            }
+        }
+
+        /**
+         * @brief Store the union of this bitmap and another bitmap within this bitmap.
+         * @param other Bitmap from which to take the union.
+         * @returns A reference to this bitmap.
+         */
+        bitmap_t &bitmap_t::operator|=(const bitmap_t &other)
+        {
+            std::vector<std::uint16_t> keys;
+            std::vector<container_t> containers;
+            keys.reserve(__keys.size() + other.__keys.size());
+            containers.reserve(__keys.size() + other.__keys.size());
+            std::size_t i = 0;
+            std::size_t j = 0;
+            while (i < __keys.size() || j < other.__keys.size())
+            {
+                if (j == other.__keys.size() || (i < __keys.size() && __keys[i] < other.__keys[j]))
+                {
+                    keys.push_back(__keys[i]);
+                    containers.push_back(std::move(__containers[i++]));
+                }
+                else if (i == __keys.size() || other.__keys[j] < __keys[i])
+                {
+                    keys.push_back(other.__keys[j]);
+                    containers.push_back(other.__containers[j++]);
+                }
+                else
+                {
+                    __bitmap_kernels_t::unite(__containers[i], other.__containers[j++]);
+                    keys.push_back(__keys[i]);
+                    containers.push_back(std::move(__containers[i++]));
+                }
+            }
+            __keys.swap(keys);
+            __containers.swap(containers);
+            return *this;
+        }
+
+        /**
+         * @brief Store the intersection of this bitmap and another bitmap within this bitmap.
+         * @param other Bitmap from which to take the intersection.
+         * @returns A reference to this bitmap.
+         */
+        bitmap_t &bitmap_t::operator&=(const bitmap_t &other)
+        {
+            std::size_t j = 0;
+            for (std::size_t i = 0; i < __keys.size(); ++i)
+            {
+                while (j < other.__keys.size() && other.__keys[j] < __keys[i])
+                {
+                    j++;
+                }
+                if (j == other.__keys.size() || other.__keys[j] != __keys[i])
+                {
+                    __containers[i].cardinality = 0;
+                    continue;
+                }
+                __bitmap_kernels_t::intersect(__containers[i], other.__containers[j]);
+            }
+            _compact();
+            return *this;
+        }
+
+        /**
+         * @brief Obtain the union of two bitmaps.
+         * @param other Bitmap from which to take the union.
+         * @returns A new bitmap containing every value in either bitmap.
+         */
+        bitmap_t bitmap_t::operator|(const bitmap_t &other) const
+        {
+            bitmap_t result = *this;
+            result |= other;
+            return result;
+        }
+
+        /**
+         * @brief Obtain the intersection of two bitmaps.
+         * @param other Bitmap from which to take the intersection.
+         * @returns A new bitmap containing every value present in both bitmaps.
+         */
+        bitmap_t bitmap_t::operator&(const bitmap_t &other) const
+        {
+            bitmap_t result = *this;
+            result &= other;
+            return result;
+        }
+
+        /**
+         * @brief Determine if two bitmaps contain exactly the same values.
+         * @param other Bitmap against which to compare.
+         * @returns True if both bitmaps contain the same values, else false.
+         */
+        bool bitmap_t::operator==(const bitmap_t &other) const
+        {
+            if (__keys != other.__keys)
+            {
+                return false;
+            }
+            std::vector<std::uint64_t> left(__BITMAP_WORDS);
+            std::vector<std::uint64_t> right(__BITMAP_WORDS);
+            for (std::size_t i = 0; i < __keys.size(); ++i)
+            {
+                if (__containers[i].cardinality != other.__containers[i].cardinality)
+                {
+                    return false;
+                }
+                std::fill(left.begin(), left.end(), 0);
+                std::fill(right.begin(), right.end(), 0);
+                __bitmap_kernels_t::expand(__containers[i], left.data());
+                __bitmap_kernels_t::expand(other.__containers[i], right.data());
+                if (left != right)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Obtain the number of values within the bitmap.
+         * @returns The cardinality of the bitmap.
+         */
+        std::size_t bitmap_t::size(void) const noexcept
+        {
+            std::size_t cardinality = 0;
+            for (const container_t &container : __containers)
+            {
+                cardinality += container.cardinality;
+            }
+            return cardinality;
+        }
+
+        /**
+         * @brief Determine if the bitmap is empty.
+         * @returns True if the bitmap contains no values, else false.
+         */
+        bool bitmap_t::is_empty(void) const noexcept
+        {
+            return __keys.empty();
+        }
+
+        /**
+         * @brief Determine if the bitmap is full.
+         * @returns True if every 32-bit value is present within the bitmap, else false.
+         */
+        bool bitmap_t::is_full(void) const noexcept
+        {
+            // Every container is checked rather than the size, which can not represent 2^32 where `std::size_t` is 32 bits wide.
+            if (__keys.size() != __BITMAP_CONTAINER_VALUES)
+            {
+                return false;
+            }
+            for (const container_t &container : __containers)
+            {
+                if (container.cardinality != __BITMAP_CONTAINER_VALUES)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Obtain an estimate of the memory used by the values of the bitmap.
+         * @returns The number of bytes used by the containers of the bitmap.
+         */
+        std::size_t bitmap_t::size_in_bytes(void) const noexcept
+        {
+            std::size_t bytes = __keys.capacity() * sizeof(std::uint16_t) + __containers.capacity() * sizeof(container_t);
+            for (const container_t &container : __containers)
+            {
+                bytes += container.array.capacity() * sizeof(std::uint16_t);
+                bytes += container.words.capacity() * sizeof(std::uint64_t);
+                bytes += container.runs.capacity() * sizeof(run_t);
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Find the position of a given key.
+         * @param key Upper 16 bits of a value.
+         * @returns The index of the first key that is not less than the given key.
+         */
+        std::size_t bitmap_t::_lower_bound(std::uint16_t key) const noexcept
+        {
+            return static_cast<std::size_t>(std::lower_bound(__keys.begin(), __keys.end(), key) - __keys.begin());
+        }
+
+        /**
+         * @brief Remove every empty container.
+         */
+        void bitmap_t::_compact(void) noexcept
+        {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < __keys.size(); ++i)
+            {
+                if (__containers[i].cardinality == 0)
+                {
+                    continue;
+                }
+                if (kept != i)
+                {
+                    __keys[kept] = __keys[i];
+                    __containers[kept] = std::move(__containers[i]);
+                }
+                kept++;
+            }
+            __keys.resize(kept);
+            __containers.resize(kept, container_t{kind_t::ARRAY, 0, {}, {}, {}});
+        }
+    }
+}
+
+#endif // BITMAP_IMPLEMENTATION
@@ -0,0 +1,335 @@
+#ifndef COW_ARRAY_HPP
+#define COW_ARRAY_HPP
+
+#include <cstddef> // std::size_t
+#include <memory> // std::shared_ptr
+#include <vector> // std::vector
+
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Copy-on-write array. Copies share their storage until one of them writes, and a write then copies only the chunk it modifies. Copying an array is therefore a cheap way to take a consistent snapshot for another thread.
+         */
+        template <typename Type>
+        struct cow_array_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Construct a new empty array.
+                 */
+                cow_array_t(void);
+
+                /**
+                 * @brief Construct a new array from a range of items.
+                 * @param items Pointer to the first item.
+                 * @param count Number of items within the range.
+                 */
+                cow_array_t(const Type *items, std::size_t count);
+
+                /**
+                 * @brief Construct a snapshot of an array. No items are copied.
+                 * @param other Array of which to take a snapshot.
+                 */
+                cow_array_t(const cow_array_t &other) = default;
+
+                /**
+                 * @brief Replace the contents of the array with a snapshot of another. No items are copied.
+                 * @param other Array of which to take a snapshot.
+                 * @returns A reference to this array.
+                 */
+                cow_array_t &operator=(const cow_array_t &other) = default;
+
+                /**
+                 * @brief Append an item to the array. Only the last chunk is copied, and only if it is shared.
+                 * @param item Item to be appended.
+                 */
+                void append(Type item);
+
+                /**
+                 * @brief Replace the item at a given index. Only the chunk holding the item is copied, and only if it is shared.
+                 * @param index Index at which the item is located.
+                 * @param item New value of the item.
+                 * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+                 */
+                void set(std::size_t index, Type item);
+
+                /**
+                 * @brief Obtain a pointer to the item at a given index. The item can not be modified through the pointer; use `set` instead.
+                 * @param index Index at which the item is located.
+                 * @returns A pointer to the item, valid until this array is next modified.
+                 * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+                 */
+                const Type *at(std::size_t index) const;
+
+                /**
+                 * @brief Call a given function for every item from the first to the last.
+                 * @param function Callable taking a `const Type &`.
+                 */
+                template <typename Function>
+                void for_each(Function function) const;
+
+                /**
+                 * @brief Remove every item from the array. Snapshots are not affected.
+                 */
+                void clear(void);
+
+                /**
+                 * @brief Obtain the number of items within the array.
+                 * @returns The size of the array.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is empty.
+                 * @returns True if the array is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is full. A copy-on-write array is never full.
+                 * @returns False.
+                 */
+                bool is_full(void) const noexcept override;
+
+            protected:
+                /**
+                 * @brief Fixed-size run of items. A chunk is shared between every array whose root refers to it.
+                 */
+                using chunk_t = std::vector<Type>;
+
+                /**
+                 * @brief Table of the chunks of an array. A root is shared between an array and its unmodified snapshots.
+                 */
+                struct root_t
+                {
+                    std::vector<std::shared_ptr<chunk_t>> chunks;
+                    std::size_t size;
+                };
+
+                /**
+                 * @brief Obtain the root of this array for writing, copying it first if it is shared.
+                 * @returns A reference to the root.
+                 */
+                root_t &_root(void);
+
+                /**
+                 * @brief Obtain a chunk of this array for writing, copying it first if it is shared.
+                 * @param root Root of this array, already obtained for writing.
+                 * @param chunk Index of the chunk within the root.
+                 * @returns A reference to the chunk.
+                 */
+                chunk_t &_chunk(root_t &root, std::size_t chunk);
+
+            protected:
+                std::shared_ptr<root_t> __root;
+        };
+    }
+}
+
+#endif // COW_ARRAY_HPP
+
+#if defined(COW_ARRAY_IMPLEMENTATION) && !defined(COW_ARRAY_IMPLEMENTED)
+#define COW_ARRAY_IMPLEMENTED
+
+#include <atomic> // std::atomic_thread_fence
+#include <utility> // std::move
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+#ifndef COW_ARRAY_CHUNK_CAPACITY
+#define COW_ARRAY_CHUNK_CAPACITY 256
+#endif // COW_ARRAY_CHUNK_CAPACITY
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty array.
+         */
+        template <typename Type>
+        cow_array_t<Type>::cow_array_t(void) : __root(std::make_shared<root_t>())
+        {
+            __root->size = 0;
+        }
+
+        /**
+         * @brief Construct a new array from a range of items.
+         * @param items Pointer to the first item.
+         * @param count Number of items within the range.
+         */
+        template <typename Type>
+        cow_array_t<Type>::cow_array_t(const Type *items, std::size_t count) : __root(std::make_shared<root_t>())
+        {
+            __root->size = count;
+            __root->chunks.reserve((count + COW_ARRAY_CHUNK_CAPACITY - 1) / COW_ARRAY_CHUNK_CAPACITY);
+            for (std::size_t start = 0; start < count; start += COW_ARRAY_CHUNK_CAPACITY)
+            {
+                const std::size_t end = start + COW_ARRAY_CHUNK_CAPACITY < count ? start + COW_ARRAY_CHUNK_CAPACITY : count;
+                std::shared_ptr<chunk_t> chunk = std::make_shared<chunk_t>();
+                chunk->reserve(COW_ARRAY_CHUNK_CAPACITY);
+                chunk->assign(items + start, items + end);
+                __root->chunks.push_back(std::move(chunk));
+            }
+        }
+
+        /**
+         * @brief Append an item to the array. Only the last chunk is copied, and only if it is shared.
+         * @param item Item to be appended.
+         */
+        template <typename Type>
+        void cow_array_t<Type>::append(Type item)
+        {
+            root_t &root = _root();
+            if (root.size % COW_ARRAY_CHUNK_CAPACITY == 0)
+            {
+                std::shared_ptr<chunk_t> chunk = std::make_shared<chunk_t>();
+                chunk->reserve(COW_ARRAY_CHUNK_CAPACITY);
+                root.chunks.push_back(std::move(chunk));
+            }
+            _chunk(root, root.chunks.size() - 1).push_back(std::move(item));
+            root.size++;
+        }
+
+        /**
+         * @brief Replace the item at a given index. Only the chunk holding the item is copied, and only if it is shared.
+         * @param index Index at which the item is located.
+         * @param item New value of the item.
+         * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        void cow_array_t<Type>::set(std::size_t index, Type item)
+        {
+            if (index >= size())
+            {
+                throw IndexError("Can not access item %zu of an array of size %zu.", index, size());
+            }
+            root_t &root = _root();
+            _chunk(root, index / COW_ARRAY_CHUNK_CAPACITY)[index % COW_ARRAY_CHUNK_CAPACITY] = std::move(item);
+        }
+
+        /**
+         * @brief Obtain a pointer to the item at a given index. The item can not be modified through the pointer; use `set` instead.
+         * @param index Index at which the item is located.
+         * @returns A pointer to the item, valid until this array is next modified.
+         * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        const Type *cow_array_t<Type>::at(std::size_t index) const
+        {
+            if (index >= size())
+            {
+                throw IndexError("Can not access item %zu of an array of size %zu.", index, size());
+            }
+            return &(*__root->chunks[index / COW_ARRAY_CHUNK_CAPACITY])[index % COW_ARRAY_CHUNK_CAPACITY];
+        }
+
+        /**
+         * @brief Call a given function for every item from the first to the last.
+         * @param function Callable taking a `const Type &`.
+         */
+        template <typename Type>
+        template <typename Function>
+        void cow_array_t<Type>::for_each(Function function) const
+        {
+            for (const std::shared_ptr<chunk_t> &chunk : __root->chunks)
+            {
+                for (const Type &item : *chunk)
+                {
+                    function(item);
+                }
+            }
+        }
+
+        /**
+         * @brief Remove every item from the array. Snapshots are not affected.
+         */
+        template <typename Type>
+        void cow_array_t<Type>::clear(void)
+        {
+            __root = std::make_shared<root_t>();
+            __root->size = 0;
+        }
+
+        /**
+         * @brief Obtain the number of items within the array.
+         * @returns The size of the array.
+         */
+        template <typename Type>
+        std::size_t cow_array_t<Type>::size(void) const noexcept
+        {
+            return __root->size;
+        }
+
+        /**
+         * @brief Determine if the array is empty.
+         * @returns True if the array is determined to be empty, else false.
+         */
+        template <typename Type>
+        bool cow_array_t<Type>::is_empty(void) const noexcept
+        {
+            return __root->size == 0;
+        }
+
+        /**
+         * @brief Determine if the array is full. A copy-on-write array is never full.
+         * @returns False.
+         */
+        template <typename Type>
+        bool cow_array_t<Type>::is_full(void) const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Obtain the root of this array for writing, copying it first if it is shared.
+         * @returns A reference to the root.
+         */
+        template <typename Type>
+        typename cow_array_t<Type>::root_t &cow_array_t<Type>::_root(void)
+        {
+            if (__root.use_count() > 1)
+            {
+                // Only the table of chunk pointers is copied; the chunks themselves stay shared.
+                __root = std::make_shared<root_t>(*__root);
+            }
+            else
+            {
+                // A snapshot on another thread may have just released the root; its reads must happen before these writes.
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *__root;
+        }
+
+        /**
+         * @brief Obtain a chunk of this array for writing, copying it first if it is shared.
+         * @param root Root of this array, already obtained for writing.
+         * @param chunk Index of the chunk within the root.
+         * @returns A reference to the chunk.
+         */
+        template <typename Type>
+        typename cow_array_t<Type>::chunk_t &cow_array_t<Type>::_chunk(root_t &root, std::size_t chunk)
+        {
+            std::shared_ptr<chunk_t> &pointer = root.chunks[chunk];
+            if (pointer.use_count() > 1)
+            {
+                std::shared_ptr<chunk_t> copy = std::make_shared<chunk_t>();
+                copy->reserve(COW_ARRAY_CHUNK_CAPACITY);
+                copy->assign(pointer->begin(), pointer->end());
+                pointer = std::move(copy);
+            }
+            else
+            {
+                std::atomic_thread_fence(std::memory_order_acquire);
+            }
+            return *pointer;
+        }
+    }
+}
+
+#endif // COW_ARRAY_IMPLEMENTATION
@@ -0,0 +1,553 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <cstddef> // std::size_t
+
+#include "collection.hpp" // collection_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Double-ended queue stored within fixed-size blocks. The blocks are tracked by a circular map, so pushing and popping at either end never moves an item, and references to items stay valid until their item is removed.
+         */
+        template <typename Type>
+        struct deque_t : public collection_t<Type>
+        {
+            public:
+                /**
+                 * @brief Construct a new empty deque.
+                 * @exception If the deque can not be allocated, an `AllocationError` is thrown.
+                 */
+                deque_t(void);
+
+                deque_t(const deque_t &) = delete;
+                deque_t &operator=(const deque_t &) = delete;
+
+                /**
+                 * @brief Append an item to the back of the deque.
+                 * @param item Item to be appended.
+                 * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void append(Type item) override;
+
+                /**
+                 * @brief Push an item onto the back of the deque.
+                 * @param item Item to push.
+                 * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void push_back(Type item);
+
+                /**
+                 * @brief Push an item onto the front of the deque.
+                 * @param item Item to push.
+                 * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void push_front(Type item);
+
+                /**
+                 * @brief Pop the item at the back of the deque.
+                 * @returns The item at the back of the deque.
+                 * @exception If the deque is evaluated to be empty, a `ValueError` is thrown.
+                 */
+                Type pop_back(void);
+
+                /**
+                 * @brief Pop the item at the front of the deque.
+                 * @returns The item at the front of the deque.
+                 * @exception If the deque is evaluated to be empty, a `ValueError` is thrown.
+                 */
+                Type pop_front(void);
+
+                /**
+                 * @brief Obtain the item at the front of the deque.
+                 * @returns A mutable pointer to the item at the front of the deque, or `nullptr` if the deque is empty.
+                 */
+                Type *front(void) const noexcept;
+
+                /**
+                 * @brief Obtain the item at the back of the deque.
+                 * @returns A mutable pointer to the item at the back of the deque, or `nullptr` if the deque is empty.
+                 */
+                Type *back(void) const noexcept;
+
+                /**
+                 * @brief Obtain a mutable pointer to an item at a given index within the deque.
+                 * @param index Index at which the item is located.
+                 * @returns A mutable pointer to the item.
+                 * @exception If the given index is greater than or equal to the size of the deque, an `IndexError` is thrown.
+                 */
+                Type *at(std::size_t index) const override;
+
+                /**
+                 * @brief Remove an item at a given index within the deque. The items between the index and the nearer end of the deque are shifted.
+                 * @param index Index at which the item is located.
+                 * @exception If the given index is greater than or equal to the size of the deque, an `IndexError` is thrown.
+                 */
+                void remove(std::size_t index) override;
+
+                /**
+                 * @brief Call a given function for every contiguous run of items from the front of the deque to the back. Every run lies within a single block.
+                 * @param function Callable taking a `Type *` to the first item of a run and a `std::size_t` number of items within the run.
+                 */
+                template <typename Function>
+                void for_each_block(Function function) const;
+
+                /**
+                 * @brief Call a given function for every item from the front of the deque to the back.
+                 * @param function Callable taking a `Type &`.
+                 */
+                template <typename Function>
+                void for_each(Function function) const;
+
+                /**
+                 * @brief Remove every item from the deque.
+                 */
+                void clear(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of items within the deque.
+                 * @returns The size of the deque.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the deque is empty.
+                 * @returns True if the deque is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the deque is full. A deque is never full.
+                 * @returns False.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Destroy every item and free every block.
+                 */
+                virtual ~deque_t();
+
+            protected:
+                /**
+                 * @brief Obtain the address of an item from its position counted from the start of the first block.
+                 * @param position Position of the item.
+                 * @returns A pointer to the item.
+                 */
+                Type *_locate(std::size_t position) const noexcept;
+
+                /**
+                 * @brief Obtain an empty block, reusing the spare block where possible.
+                 * @returns A pointer to the block.
+                 * @exception If the block can not be allocated, an `AllocationError` is thrown.
+                 */
+                Type *_acquire(void);
+
+                /**
+                 * @brief Return an empty block, keeping it as the spare block where possible.
+                 * @param block Block to return.
+                 */
+                void _release(Type *block) noexcept;
+
+                /**
+                 * @brief Ensure the map can hold one more block.
+                 * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void _reserve_map(void);
+
+            protected:
+                Type **__map;
+                std::size_t __map_capacity;
+                std::size_t __head;
+                std::size_t __blocks;
+                std::size_t __offset;
+                std::size_t __size;
+                Type *__spare;
+        };
+    }
+}
+
+#endif // DEQUE_HPP
+
+#if defined(DEQUE_IMPLEMENTATION) && !defined(DEQUE_IMPLEMENTED)
+#define DEQUE_IMPLEMENTED
+
+#include <cstdlib> // std::calloc, std::malloc, std::free
+#include <new> // placement new
+#include <utility> // std::move
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+#ifndef DEQUE_BLOCK_CAPACITY
+#define DEQUE_BLOCK_CAPACITY 256
+#endif // DEQUE_BLOCK_CAPACITY
+
+#ifndef DEQUE_MAP_CAPACITY
+#define DEQUE_MAP_CAPACITY 8
+#endif // DEQUE_MAP_CAPACITY
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty deque.
+         * @exception If the deque can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        deque_t<Type>::deque_t(void) : __map(nullptr), __map_capacity(DEQUE_MAP_CAPACITY), __head(0), __blocks(0), __offset(0), __size(0), __spare(nullptr)
+        {
+            __map = static_cast<Type **>(std::calloc(__map_capacity, sizeof(Type *)));
+            if (nullptr == __map)
+            {
+                throw AllocationError("Can not allocate enough memory for the deque.");
+            }
+        }
+
+        /**
+         * @brief Append an item to the back of the deque.
+         * @param item Item to be appended.
+         * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void deque_t<Type>::append(Type item)
+        {
+            push_back(std::move(item));
+        }
+
+        /**
+         * @brief Push an item onto the back of the deque.
+         * @param item Item to push.
+         * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void deque_t<Type>::push_back(Type item)
+        {
+            if (__offset + __size == __blocks * DEQUE_BLOCK_CAPACITY)
+            {
+                _reserve_map();
+                __map[(__head + __blocks) % __map_capacity] = _acquire();
+                __blocks++;
+            }
+            new (_locate(__offset + __size)) Type(std::move(item));
+            __size++;
+        }
+
+        /**
+         * @brief Push an item onto the front of the deque.
+         * @param item Item to push.
+         * @exception If the deque can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void deque_t<Type>::push_front(Type item)
+        {
+            if (0 == __offset)
+            {
+                _reserve_map();
+                __head = (__head + __map_capacity - 1) % __map_capacity;
+                __map[__head] = _acquire();
+                __blocks++;
+                __offset = DEQUE_BLOCK_CAPACITY;
+            }
+            new (_locate(__offset - 1)) Type(std::move(item));
+            __offset--;
+            __size++;
+        }
+
+        /**
+         * @brief Pop the item at the back of the deque.
+         * @returns The item at the back of the deque.
+         * @exception If the deque is evaluated to be empty, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        Type deque_t<Type>::pop_back(void)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not pop an item from an empty deque.");
+            }
+            Type *slot = _locate(__offset + __size - 1);
+            Type item = std::move(*slot);
+            slot->~Type();
+            __size--;
+            if (__offset + __size == (__blocks - 1) * DEQUE_BLOCK_CAPACITY)
+            {
+                __blocks--;
+                _release(__map[(__head + __blocks) % __map_capacity]);
+            }
+            return item;
+        }
+
+        /**
+         * @brief Pop the item at the front of the deque.
+         * @returns The item at the front of the deque.
+         * @exception If the deque is evaluated to be empty, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        Type deque_t<Type>::pop_front(void)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not pop an item from an empty deque.");
+            }
+            Type *slot = _locate(__offset);
+            Type item = std::move(*slot);
+            slot->~Type();
+            __offset++;
+            __size--;
+            if (DEQUE_BLOCK_CAPACITY == __offset)
+            {
+                _release(__map[__head]);
+                __head = (__head + 1) % __map_capacity;
+                __blocks--;
+                __offset = 0;
+            }
+            return item;
+        }
+
+        /**
+         * @brief Obtain the item at the front of the deque.
+         * @returns A mutable pointer to the item at the front of the deque, or `nullptr` if the deque is empty.
+         */
+        template <typename Type>
+        Type *deque_t<Type>::front(void) const noexcept
+        {
+            return is_empty() ? nullptr : _locate(__offset);
+        }
+
+        /**
+         * @brief Obtain the item at the back of the deque.
+         * @returns A mutable pointer to the item at the back of the deque, or `nullptr` if the deque is empty.
+         */
+        template <typename Type>
+        Type *deque_t<Type>::back(void) const noexcept
+        {
+            return is_empty() ? nullptr : _locate(__offset + __size - 1);
+        }
+
+        /**
+         * @brief Obtain a mutable pointer to an item at a given index within the deque.
+         * @param index Index at which the item is located.
+         * @returns A mutable pointer to the item.
+         * @exception If the given index is greater than or equal to the size of the deque, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        Type *deque_t<Type>::at(std::size_t index) const
+        {
+            if (index >= __size)
+            {
+                throw IndexError("Can not access item %zu of a deque of size %zu.", index, __size);
+            }
+            return _locate(__offset + index);
+        }
+
+        /**
+         * @brief Remove an item at a given index within the deque. The items between the index and the nearer end of the deque are shifted.
+         * @param index Index at which the item is located.
+         * @exception If the given index is greater than or equal to the size of the deque, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        void deque_t<Type>::remove(std::size_t index)
+        {
+            if (index >= __size)
+            {
+                throw IndexError("Can not remove item %zu of a deque of size %zu.", index, __size);
+            }
+            if (index < __size / 2)
+            {
+                for (std::size_t i = index; i > 0; --i)
+                {
+                    *_locate(__offset + i) = std::move(*_locate(__offset + i - 1));
+                }
+                pop_front();
+            }
+            else
+            {
+                for (std::size_t i = index; i + 1 < __size; ++i)
+                {
+                    *_locate(__offset + i) = std::move(*_locate(__offset + i + 1));
+                }
+                pop_back();
+            }
+        }
+
+        /**
+         * @brief Call a given function for every contiguous run of items from the front of the deque to the back. Every run lies within a single block.
+         * @param function Callable taking a `Type *` to the first item of a run and a `std::size_t` number of items within the run.
+         */
+        template <typename Type>
+        template <typename Function>
+        void deque_t<Type>::for_each_block(Function function) const
+        {
+            std::size_t position = __offset;
+            std::size_t remaining = __size;
+            while (remaining > 0)
+            {
+                const std::size_t within = position % DEQUE_BLOCK_CAPACITY;
+                const std::size_t count = DEQUE_BLOCK_CAPACITY - within < remaining ? DEQUE_BLOCK_CAPACITY - within : remaining;
+                function(_locate(position), count);
+                position += count;
+                remaining -= count;
+            }
+        }
+
+        /**
+         * @brief Call a given function for every item from the front of the deque to the back.
+         * @param function Callable taking a `Type &`.
+         */
+        template <typename Type>
+        template <typename Function>
+        void deque_t<Type>::for_each(Function function) const
+        {
+            for_each_block([&](Type *items, std::size_t count)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    function(items[i]);
+                }
+            });
+        }
+
+        /**
+         * @brief Remove every item from the deque.
+         */
+        template <typename Type>
+        void deque_t<Type>::clear(void) noexcept
+        {
+            for_each([](Type &item)
+            {
+                item.~Type();
+            });
+            for (std::size_t i = 0; i < __blocks; ++i)
+            {
+                _release(__map[(__head + i) % __map_capacity]);
+            }
+            __head = 0;
+            __blocks = 0;
+            __offset = 0;
+            __size = 0;
+        }
+
+        /**
+         * @brief Obtain the number of items within the deque.
+         * @returns The size of the deque.
+         */
+        template <typename Type>
+        std::size_t deque_t<Type>::size(void) const noexcept
+        {
+            return __size;
+        }
+
+        /**
+         * @brief Determine if the deque is empty.
+         * @returns True if the deque is determined to be empty, else false.
+         */
+        template <typename Type>
+        bool deque_t<Type>::is_empty(void) const noexcept
+        {
+            return __size == 0;
+        }
+
+        /**
+         * @brief Determine if the deque is full. A deque is never full.
+         * @returns False.
+         */
+        template <typename Type>
+        bool deque_t<Type>::is_full(void) const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Destroy every item and free every block.
+         */
+        template <typename Type>
+        deque_t<Type>::~deque_t()
+        {
+            clear();
+            std::free(__spare);
+            std::free(__map);
+        }
+
+        /**
+         * @brief Obtain the address of an item from its position counted from the start of the first block.
+         * @param position Position of the item.
+         * @returns A pointer to the item.
+         */
+        template <typename Type>
+        Type *deque_t<Type>::_locate(std::size_t position) const noexcept
+        {
+            return __map[(__head + position / DEQUE_BLOCK_CAPACITY) % __map_capacity] + position % DEQUE_BLOCK_CAPACITY;
+        }
+
+        /**
+         * @brief Obtain an empty block, reusing the spare block where possible.
+         * @returns A pointer to the block.
+         * @exception If the block can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        Type *deque_t<Type>::_acquire(void)
+        {
+            if (nullptr != __spare)
+            {
+                Type *block = __spare;
+                __spare = nullptr;
+                return block;
+            }
+            Type *block = static_cast<Type *>(std::malloc(sizeof(Type) * DEQUE_BLOCK_CAPACITY));
+            if (nullptr == block)
+            {
+                throw AllocationError("Can not allocate enough memory for the deque.");
+            }
+            return block;
+        }
+
+        /**
+         * @brief Return an empty block, keeping it as the spare block where possible.
+         * @param block Block to return.
+         */
+        template <typename Type>
+        void deque_t<Type>::_release(Type *block) noexcept
+        {
+            // A single spare block stops a deque that oscillates across a block boundary from allocating on every push.
+            if (nullptr == __spare)
+            {
+                __spare = block;
+                return;
+            }
+            std::free(block);
+        }
+
+        /**
+         * @brief Ensure the map can hold one more block.
+         * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void deque_t<Type>::_reserve_map(void)
+        {
+            if (__blocks < __map_capacity)
+            {
+                return;
+            }
+            const std::size_t capacity = __map_capacity * 2;
+            Type **map = static_cast<Type **>(std::calloc(capacity, sizeof(Type *)));
+            if (nullptr == map)
+            {
+                throw AllocationError("Can not resize deque.");
+            }
+            // Only the block pointers move; the blocks, and so the items, stay where they are.
+            for (std::size_t i = 0; i < __blocks; ++i)
+            {
+                map[i] = __map[(__head + i) % __map_capacity];
+            }
+            std::free(__map);
+            __map = map;
+            __map_capacity = capacity;
+            __head = 0;
+        }
+    }
+}
+
+#endif // DEQUE_IMPLEMENTATION
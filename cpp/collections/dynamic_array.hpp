@@ -40,7 +40,8 @@ namespace polutils
 
 #endif // DYNAMIC_ARRAY_HPP
 
-#ifdef DYNAMIC_ARRAY_IMPLEMENTATION
+#if defined(DYNAMIC_ARRAY_IMPLEMENTATION) && !defined(DYNAMIC_ARRAY_IMPLEMENTED)
+#define DYNAMIC_ARRAY_IMPLEMENTED
 
 namespace polutils
 {
@@ -0,0 +1,460 @@
+#ifndef FLAT_MAP_HPP
+#define FLAT_MAP_HPP
+
+#include <cstddef> // std::size_t
+#include <functional> // std::less
+#include <type_traits> // std::is_trivially_copyable
+
+#include "dynamic_array.hpp" // dynamic_array_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Sorted associative array. Keys and values are stored within two parallel sorted dynamic arrays, which keeps lookups within contiguous memory.
+         */
+        template <typename Key, typename Value, typename Compare = std::less<Key>>
+        struct flat_map_t : public sized_t
+        {
+            static_assert(std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value, "The keys and values of a flat map must be trivially copyable.");
+
+            public:
+                /**
+                 * @brief Construct a new empty map.
+                 * @exception If the map can not be allocated, an `AllocationError` is thrown.
+                 */
+                flat_map_t(void);
+
+                /**
+                 * @brief Construct a new empty map with a given initial capacity.
+                 * @param capacity Initial capacity of the map.
+                 * @exception If the given capacity is zero, a `ValueError` is thrown.
+                 * @exception If the map can not be allocated, an `AllocationError` is thrown.
+                 */
+                explicit flat_map_t(std::size_t capacity);
+
+                /**
+                 * @brief Construct a new map from unsorted parallel ranges of keys and values. The ranges are sorted once; if a key occurs more than once, its last value is kept.
+                 * @param keys Pointer to the first key.
+                 * @param values Pointer to the first value.
+                 * @param count Number of entries within both ranges.
+                 * @exception If the map can not be allocated, an `AllocationError` is thrown.
+                 */
+                flat_map_t(const Key *keys, const Value *values, std::size_t count);
+
+                flat_map_t(const flat_map_t &) = delete;
+                flat_map_t &operator=(const flat_map_t &) = delete;
+
+                /**
+                 * @brief Insert a single entry into the map. If the key is already present, its value is replaced.
+                 * @param key Key of the entry.
+                 * @param value Value of the entry.
+                 * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void insert(Key key, Value value);
+
+                /**
+                 * @brief Insert a batch of unsorted entries into the map. The batch is sorted and then merged with the map in a single pass. If a key is already present, its value is replaced by the value within the batch.
+                 * @param keys Pointer to the first key.
+                 * @param values Pointer to the first value.
+                 * @param count Number of entries within both ranges.
+                 * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void merge(const Key *keys, const Value *values, std::size_t count);
+
+                /**
+                 * @brief Obtain the value of a given key.
+                 * @param key Key of the entry.
+                 * @returns A mutable pointer to the value of the key.
+                 * @exception If the key is not present within the map, a `ValueError` is thrown.
+                 */
+                Value *at(const Key &key) const;
+
+                /**
+                 * @brief Search for the value of a given key.
+                 * @param key Key of the entry.
+                 * @returns A mutable pointer to the value of the key, or `nullptr` if the key is not present.
+                 */
+                Value *find(const Key &key) const noexcept;
+
+                /**
+                 * @brief Determine if a given key is present within the map.
+                 * @param key Key of the entry.
+                 * @returns True if the key is present, else false.
+                 */
+                bool contains(const Key &key) const noexcept;
+
+                /**
+                 * @brief Remove the entry of a given key.
+                 * @param key Key of the entry.
+                 * @exception If the key is not present within the map, a `ValueError` is thrown.
+                 */
+                void remove(const Key &key);
+
+                /**
+                 * @brief Obtain the sorted keys of the map. The keys are contiguous and hold `size()` items.
+                 * @returns A pointer to the first key.
+                 */
+                const Key *keys(void) const noexcept;
+
+                /**
+                 * @brief Obtain the values of the map in the order of their keys. The values are contiguous and hold `size()` items.
+                 * @returns A mutable pointer to the first value.
+                 */
+                Value *values(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of entries within the map.
+                 * @returns The size of the map.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the map is empty.
+                 * @returns True if the map is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the map is full.
+                 * @returns True if the size of the map is greater than or equal to its capacity.
+                 */
+                bool is_full(void) const noexcept override;
+
+            protected:
+                /**
+                 * @brief Find the position of the first key that is not less than a given key. The search is branchless; each step is a conditional move rather than a jump.
+                 * @param key Key for which to search.
+                 * @returns The index of the first key that is not less than the given key.
+                 */
+                std::size_t _lower_bound(const Key &key) const noexcept;
+
+                /**
+                 * @brief Sort parallel ranges of keys and values into two arrays, keeping the last value of any repeated key.
+                 * @param keys Pointer to the first key.
+                 * @param values Pointer to the first value.
+                 * @param count Number of entries within both ranges.
+                 * @param sorted_keys Array into which to append the sorted keys.
+                 * @param sorted_values Array into which to append the values in the order of their keys.
+                 */
+                void _sort(const Key *keys, const Value *values, std::size_t count, dynamic_array_t<Key> &sorted_keys, dynamic_array_t<Value> &sorted_values) const;
+
+            protected:
+                dynamic_array_t<Key> __keys;
+                dynamic_array_t<Value> __values;
+                Compare __compare;
+        };
+    }
+}
+
+#endif // FLAT_MAP_HPP
+
+#if defined(FLAT_MAP_IMPLEMENTATION) && !defined(FLAT_MAP_IMPLEMENTED)
+#define FLAT_MAP_IMPLEMENTED
+
+#include <algorithm> // std::stable_sort, std::move_backward
+
+#define DYNAMIC_ARRAY_IMPLEMENTATION
+#include "dynamic_array.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty map.
+         * @exception If the map can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        flat_map_t<Key, Value, Compare>::flat_map_t(void) : __keys(), __values(), __compare() {}
+
+        /**
+         * @brief Construct a new empty map with a given initial capacity.
+         * @param capacity Initial capacity of the map.
+         * @exception If the given capacity is zero, a `ValueError` is thrown.
+         * @exception If the map can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        flat_map_t<Key, Value, Compare>::flat_map_t(std::size_t capacity) : __keys(capacity == 0 ? 1 : capacity), __values(capacity == 0 ? 1 : capacity), __compare()
+        {
+            if (0 == capacity)
+            {
+                throw ValueError("Can not construct a map with a capacity of zero.");
+            }
+        }
+
+        /**
+         * @brief Construct a new map from unsorted parallel ranges of keys and values. The ranges are sorted once; if a key occurs more than once, its last value is kept.
+         * @param keys Pointer to the first key.
+         * @param values Pointer to the first value.
+         * @param count Number of entries within both ranges.
+         * @exception If the map can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        flat_map_t<Key, Value, Compare>::flat_map_t(const Key *keys, const Value *values, std::size_t count) : __keys(count == 0 ? 1 : count), __values(count == 0 ? 1 : count), __compare()
+        {
+            _sort(keys, values, count, __keys, __values);
+        }
+
+        /**
+         * @brief Insert a single entry into the map. If the key is already present, its value is replaced.
+         * @param key Key of the entry.
+         * @param value Value of the entry.
+         * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        void flat_map_t<Key, Value, Compare>::insert(Key key, Value value)
+        {
+            const std::size_t index = _lower_bound(key);
+            if (index < size() && !__compare(key, __keys.data()[index]))
+            {
+                __values.data()[index] = value;
+                return;
+            }
+            // Grow both arrays by one, then shift the tail up to open a slot at the index.
+            __keys.append(key);
+            __values.append(value);
+            Key *keys = __keys.data();
+            Value *values = __values.data();
+            std::move_backward(keys + index, keys + size() - 1, keys + size());
+            std::move_backward(values + index, values + size() - 1, values + size());
+            keys[index] = key;
+            values[index] = value;
+        }
+
+        /**
+         * @brief Insert a batch of unsorted entries into the map. The batch is sorted and then merged with the map in a single pass. If a key is already present, its value is replaced by the value within the batch.
+         * @param keys Pointer to the first key.
+         * @param values Pointer to the first value.
+         * @param count Number of entries within both ranges.
+         * @exception If the map can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        void flat_map_t<Key, Value, Compare>::merge(const Key *keys, const Value *values, std::size_t count)
+        {
+            if (0 == count)
+            {
+                return;
+            }
+            dynamic_array_t<Key> batch_keys(count);
+            dynamic_array_t<Value> batch_values(count);
+            _sort(keys, values, count, batch_keys, batch_values);
+            dynamic_array_t<Key> merged_keys(size() + batch_keys.size());
+            dynamic_array_t<Value> merged_values(size() + batch_keys.size());
+            const Key *left_keys = __keys.data();
+            const Value *left_values = __values.data();
+            const Key *right_keys = batch_keys.data();
+            const Value *right_values = batch_values.data();
+            std::size_t i = 0;
+            std::size_t j = 0;
+            while (i < size() && j < batch_keys.size())
+            {
+                if (__compare(left_keys[i], right_keys[j]))
+                {
+                    merged_keys.append(left_keys[i]);
+                    merged_values.append(left_values[i++]);
+                }
+                else if (__compare(right_keys[j], left_keys[i]))
+                {
+                    merged_keys.append(right_keys[j]);
+                    merged_values.append(right_values[j++]);
+                }
+                else
+                {
+                    merged_keys.append(right_keys[j]);
+                    merged_values.append(right_values[j++]);
+                    i++;
+                }
+            }
+            for (; i < size(); ++i)
+            {
+                merged_keys.append(left_keys[i]);
+                merged_values.append(left_values[i]);
+            }
+            for (; j < batch_keys.size(); ++j)
+            {
+                merged_keys.append(right_keys[j]);
+                merged_values.append(right_values[j]);
+            }
+            __keys.swap(merged_keys);
+            __values.swap(merged_values);
+        }
+
+        /**
+         * @brief Obtain the value of a given key.
+         * @param key Key of the entry.
+         * @returns A mutable pointer to the value of the key.
+         * @exception If the key is not present within the map, a `ValueError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        Value *flat_map_t<Key, Value, Compare>::at(const Key &key) const
+        {
+            Value *value = find(key);
+            if (nullptr == value)
+            {
+                throw ValueError("Can not access a key that is not present within the map.");
+            }
+            return value;
+        }
+
+        /**
+         * @brief Search for the value of a given key.
+         * @param key Key of the entry.
+         * @returns A mutable pointer to the value of the key, or `nullptr` if the key is not present.
+         */
+        template <typename Key, typename Value, typename Compare>
+        Value *flat_map_t<Key, Value, Compare>::find(const Key &key) const noexcept
+        {
+            const std::size_t index = _lower_bound(key);
+            if (index == size() || __compare(key, __keys.data()[index]))
+            {
+                return nullptr;
+            }
+            return &__values.data()[index];
+        }
+
+        /**
+         * @brief Determine if a given key is present within the map.
+         * @param key Key of the entry.
+         * @returns True if the key is present, else false.
+         */
+        template <typename Key, typename Value, typename Compare>
+        bool flat_map_t<Key, Value, Compare>::contains(const Key &key) const noexcept
+        {
+            return nullptr != find(key);
+        }
+
+        /**
+         * @brief Remove the entry of a given key.
+         * @param key Key of the entry.
+         * @exception If the key is not present within the map, a `ValueError` is thrown.
+         */
+        template <typename Key, typename Value, typename Compare>
+        void flat_map_t<Key, Value, Compare>::remove(const Key &key)
+        {
+            const std::size_t index = _lower_bound(key);
+            if (index == size() || __compare(key, __keys.data()[index]))
+            {
+                throw ValueError("Can not remove a key that is not present within the map.");
+            }
+            __keys.remove(index);
+            __values.remove(index);
+        }
+
+        /**
+         * @brief Obtain the sorted keys of the map. The keys are contiguous and hold `size()` items.
+         * @returns A pointer to the first key.
+         */
+        template <typename Key, typename Value, typename Compare>
+        const Key *flat_map_t<Key, Value, Compare>::keys(void) const noexcept
+        {
+            return __keys.data();
+        }
+
+        /**
+         * @brief Obtain the values of the map in the order of their keys. The values are contiguous and hold `size()` items.
+         * @returns A mutable pointer to the first value.
+         */
+        template <typename Key, typename Value, typename Compare>
+        Value *flat_map_t<Key, Value, Compare>::values(void) const noexcept
+        {
+            return __values.data();
+        }
+
+        /**
+         * @brief Obtain the number of entries within the map.
+         * @returns The size of the map.
+         */
+        template <typename Key, typename Value, typename Compare>
+        std::size_t flat_map_t<Key, Value, Compare>::size(void) const noexcept
+        {
+            return __keys.size();
+        }
+
+        /**
+         * @brief Determine if the map is empty.
+         * @returns True if the map is determined to be empty, else false.
+         */
+        template <typename Key, typename Value, typename Compare>
+        bool flat_map_t<Key, Value, Compare>::is_empty(void) const noexcept
+        {
+            return __keys.size() == 0;
+        }
+
+        /**
+         * @brief Determine if the map is full.
+         * @returns True if the size of the map is greater than or equal to its capacity.
+         */
+        template <typename Key, typename Value, typename Compare>
+        bool flat_map_t<Key, Value, Compare>::is_full(void) const noexcept
+        {
+            return __keys.is_full();
+        }
+
+        /**
+         * @brief Find the position of the first key that is not less than a given key. The search is branchless; each step is a conditional move rather than a jump.
+         * @param key Key for which to search.
+         * @returns The index of the first key that is not less than the given key.
+         */
+        template <typename Key, typename Value, typename Compare>
+        std::size_t flat_map_t<Key, Value, Compare>::_lower_bound(const Key &key) const noexcept
+        {
+            std::size_t length = size();
+            if (0 == length)
+            {
+                return 0;
+            }
+            const Key *first = __keys.data();
+            const Key *base = first;
+            while (length > 1)
+            {
+                const std::size_t half = length / 2;
+                base = __compare(base[half - 1], key) ? base + half : base;
+                length -= half;
+            }
+            return static_cast<std::size_t>(base - first) + (__compare(*base, key) ? 1 : 0);
+        }
+
+        /**
+         * @brief Sort parallel ranges of keys and values into two arrays, keeping the last value of any repeated key.
+         * @param keys Pointer to the first key.
+         * @param values Pointer to the first value.
+         * @param count Number of entries within both ranges.
+         * @param sorted_keys Array into which to append the sorted keys.
+         * @param sorted_values Array into which to append the values in the order of their keys.
+         */
+        template <typename Key, typename Value, typename Compare>
+        void flat_map_t<Key, Value, Compare>::_sort(const Key *keys, const Value *values, std::size_t count, dynamic_array_t<Key> &sorted_keys, dynamic_array_t<Value> &sorted_values) const
+        {
+            if (0 == count)
+            {
+                return;
+            }
+            dynamic_array_t<std::size_t> order(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                order.append(i);
+            }
+            // A stable sort keeps repeated keys in their original order, so the last of each run is the newest.
+            std::stable_sort(order.data(), order.data() + count, [&](std::size_t a, std::size_t b)
+            {
+                return __compare(keys[a], keys[b]);
+            });
+            sorted_keys.reserve(sorted_keys.size() + count);
+            sorted_values.reserve(sorted_values.size() + count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t current = order.data()[i];
+                if (i + 1 < count && !__compare(keys[current], keys[order.data()[i + 1]]))
+                {
+                    continue;
+                }
+                sorted_keys.append(keys[current]);
+                sorted_values.append(values[current]);
+            }
+        }
+    }
+}
+
+#endif // FLAT_MAP_IMPLEMENTATION
@@ -0,0 +1,441 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cstddef> // std::size_t
+
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Links embedded within an element of an intrusive list. An element is added to a list by deriving from this structure.
+         */
+        struct list_hook_t
+        {
+            /**
+             * @brief Construct a new unlinked hook.
+             */
+            list_hook_t(void) noexcept;
+
+            /**
+             * @brief Copying an element does not copy its membership of a list; the copy is unlinked.
+             */
+            list_hook_t(const list_hook_t &) noexcept;
+
+            /**
+             * @brief Assigning to an element does not change its membership of a list.
+             * @returns A reference to this hook.
+             */
+            list_hook_t &operator=(const list_hook_t &) noexcept;
+
+            /**
+             * @brief Determine if the element is linked into a list.
+             * @returns True if the element is linked into a list, else false.
+             */
+            bool is_linked(void) const noexcept;
+
+            list_hook_t *previous;
+            list_hook_t *next;
+        };
+
+        /**
+         * @brief Doubly linked list whose links are embedded within its elements. The list never allocates; it only links and unlinks elements owned elsewhere.
+         */
+        template <typename Type>
+        struct intrusive_list_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Construct a new empty list.
+                 */
+                intrusive_list_t(void) noexcept;
+
+                intrusive_list_t(const intrusive_list_t &) = delete;
+                intrusive_list_t &operator=(const intrusive_list_t &) = delete;
+
+                /**
+                 * @brief Link an element at the front of the list.
+                 * @param element Element to link.
+                 * @exception If the element is already linked into a list, a `ValueError` is thrown.
+                 */
+                void push_front(Type &element);
+
+                /**
+                 * @brief Link an element at the back of the list.
+                 * @param element Element to link.
+                 * @exception If the element is already linked into a list, a `ValueError` is thrown.
+                 */
+                void push_back(Type &element);
+
+                /**
+                 * @brief Unlink the element at the front of the list.
+                 * @returns A pointer to the unlinked element.
+                 * @exception If the list is evaluated to be empty, a `ValueError` is thrown.
+                 */
+                Type *pop_front(void);
+
+                /**
+                 * @brief Unlink the element at the back of the list.
+                 * @returns A pointer to the unlinked element.
+                 * @exception If the list is evaluated to be empty, a `ValueError` is thrown.
+                 */
+                Type *pop_back(void);
+
+                /**
+                 * @brief Unlink a given element from the list.
+                 * @param element Element to unlink. The element must be linked into this list.
+                 * @exception If the element is not linked into a list, a `ValueError` is thrown.
+                 */
+                void remove(Type &element);
+
+                /**
+                 * @brief Move a given element — already linked into this list — to the front of the list.
+                 * @param element Element to move.
+                 * @exception If the element is not linked into a list, a `ValueError` is thrown.
+                 */
+                void move_to_front(Type &element);
+
+                /**
+                 * @brief Obtain the element at the front of the list.
+                 * @returns A pointer to the element at the front of the list, or `nullptr` if the list is empty.
+                 */
+                Type *front(void) const noexcept;
+
+                /**
+                 * @brief Obtain the element at the back of the list.
+                 * @returns A pointer to the element at the back of the list, or `nullptr` if the list is empty.
+                 */
+                Type *back(void) const noexcept;
+
+                /**
+                 * @brief Call a given function for every element from the front of the list to the back.
+                 * @param function Callable taking a `Type &`.
+                 */
+                template <typename Function>
+                void for_each(Function function) const;
+
+                /**
+                 * @brief Unlink every element from the list.
+                 */
+                void clear(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of elements linked into the list.
+                 * @returns The size of the list.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the list is empty.
+                 * @returns True if the list is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the list is full. An intrusive list is never full.
+                 * @returns False.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Unlink every remaining element.
+                 */
+                virtual ~intrusive_list_t();
+
+            protected:
+                /**
+                 * @brief Link a hook between two adjacent hooks.
+                 * @param hook Hook to link.
+                 * @param previous Hook that will precede the linked hook.
+                 * @param next Hook that will follow the linked hook.
+                 */
+                void _link(list_hook_t *hook, list_hook_t *previous, list_hook_t *next) noexcept;
+
+                /**
+                 * @brief Unlink a hook from its neighbours.
+                 * @param hook Hook to unlink.
+                 */
+                void _unlink(list_hook_t *hook) noexcept;
+
+            protected:
+                list_hook_t __sentinel;
+                std::size_t __size;
+        };
+    }
+}
+
+#endif // INTRUSIVE_LIST_HPP
+
+#if defined(INTRUSIVE_LIST_IMPLEMENTATION) && !defined(INTRUSIVE_LIST_IMPLEMENTED)
+#define INTRUSIVE_LIST_IMPLEMENTED
+
+#include <type_traits> // std::is_base_of
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new unlinked hook.
+         */
+        list_hook_t::list_hook_t(void) noexcept : previous(nullptr), next(nullptr) {}
+
+        /**
+         * @brief Copying an element does not copy its membership of a list; the copy is unlinked.
+         */
+        list_hook_t::list_hook_t(const list_hook_t &) noexcept : previous(nullptr), next(nullptr) {}
+
+        /**
+         * @brief Assigning to an element does not change its membership of a list.
+         * @returns A reference to this hook.
+         */
+        list_hook_t &list_hook_t::operator=(const list_hook_t &) noexcept
+        {
+            return *this;
+        }
+
+        /**
+         * @brief Determine if the element is linked into a list.
+         * @returns True if the element is linked into a list, else false.
+         */
+        bool list_hook_t::is_linked(void) const noexcept
+        {
+            return nullptr != next;
+        }
+
+        /**
+         * @brief Construct a new empty list.
+         */
+        template <typename Type>
+        intrusive_list_t<Type>::intrusive_list_t(void) noexcept : __sentinel(), __size(0)
+        {
+            static_assert(std::is_base_of<list_hook_t, Type>::value, "The element of an intrusive list must derive from `list_hook_t`.");
+            __sentinel.previous = &__sentinel;
+            __sentinel.next = &__sentinel;
+        }
+
+        /**
+         * @brief Link an element at the front of the list.
+         * @param element Element to link.
+         * @exception If the element is already linked into a list, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::push_front(Type &element)
+        {
+            if (element.is_linked())
+            {
+                throw ValueError("Can not link an element that is already linked into a list.");
+            }
+            _link(&element, &__sentinel, __sentinel.next);
+        }
+
+        /**
+         * @brief Link an element at the back of the list.
+         * @param element Element to link.
+         * @exception If the element is already linked into a list, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::push_back(Type &element)
+        {
+            if (element.is_linked())
+            {
+                throw ValueError("Can not link an element that is already linked into a list.");
+            }
+            _link(&element, __sentinel.previous, &__sentinel);
+        }
+
+        /**
+         * @brief Unlink the element at the front of the list.
+         * @returns A pointer to the unlinked element.
+         * @exception If the list is evaluated to be empty, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        Type *intrusive_list_t<Type>::pop_front(void)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not pop an element from an empty list.");
+            }
+            list_hook_t *hook = __sentinel.next;
+            _unlink(hook);
+            return static_cast<Type *>(hook);
+        }
+
+        /**
+         * @brief Unlink the element at the back of the list.
+         * @returns A pointer to the unlinked element.
+         * @exception If the list is evaluated to be empty, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        Type *intrusive_list_t<Type>::pop_back(void)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not pop an element from an empty list.");
+            }
+            list_hook_t *hook = __sentinel.previous;
+            _unlink(hook);
+            return static_cast<Type *>(hook);
+        }
+
+        /**
+         * @brief Unlink a given element from the list.
+         * @param element Element to unlink. The element must be linked into this list.
+         * @exception If the element is not linked into a list, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::remove(Type &element)
+        {
+            if (!element.is_linked())
+            {
+                throw ValueError("Can not unlink an element that is not linked into a list.");
+            }
+            _unlink(&element);
+        }
+
+        /**
+         * @brief Move a given element — already linked into this list — to the front of the list.
+         * @param element Element to move.
+         * @exception If the element is not linked into a list, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::move_to_front(Type &element)
+        {
+            if (!element.is_linked())
+            {
+                throw ValueError("Can not move an element that is not linked into a list.");
+            }
+            if (__sentinel.next == &element)
+            {
+                return;
+            }
+            _unlink(&element);
+            _link(&element, &__sentinel, __sentinel.next);
+        }
+
+        /**
+         * @brief Obtain the element at the front of the list.
+         * @returns A pointer to the element at the front of the list, or `nullptr` if the list is empty.
+         */
+        template <typename Type>
+        Type *intrusive_list_t<Type>::front(void) const noexcept
+        {
+            return is_empty() ? nullptr : static_cast<Type *>(__sentinel.next);
+        }
+
+        /**
+         * @brief Obtain the element at the back of the list.
+         * @returns A pointer to the element at the back of the list, or `nullptr` if the list is empty.
+         */
+        template <typename Type>
+        Type *intrusive_list_t<Type>::back(void) const noexcept
+        {
+            return is_empty() ? nullptr : static_cast<Type *>(__sentinel.previous);
+        }
+
+        /**
+         * @brief Call a given function for every element from the front of the list to the back.
+         * @param function Callable taking a `Type &`.
+         */
+        template <typename Type>
+        template <typename Function>
+        void intrusive_list_t<Type>::for_each(Function function) const
+        {
+            for (list_hook_t *hook = __sentinel.next; hook != &__sentinel;)
+            {
+                // The next hook is read first so that the function may unlink the current element.
+                list_hook_t *next = hook->next;
+                function(*static_cast<Type *>(hook));
+                hook = next;
+            }
+        }
+
+        /**
+         * @brief Unlink every element from the list.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::clear(void) noexcept
+        {
+            while (!is_empty())
+            {
+                _unlink(__sentinel.next);
+            }
+        }
+
+        /**
+         * @brief Obtain the number of elements linked into the list.
+         * @returns The size of the list.
+         */
+        template <typename Type>
+        std::size_t intrusive_list_t<Type>::size(void) const noexcept
+        {
+            return __size;
+        }
+
+        /**
+         * @brief Determine if the list is empty.
+         * @returns True if the list is determined to be empty, else false.
+         */
+        template <typename Type>
+        bool intrusive_list_t<Type>::is_empty(void) const noexcept
+        {
+            return __size == 0;
+        }
+
+        /**
+         * @brief Determine if the list is full. An intrusive list is never full.
+         * @returns False.
+         */
+        template <typename Type>
+        bool intrusive_list_t<Type>::is_full(void) const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Unlink every remaining element.
+         */
+        template <typename Type>
+        intrusive_list_t<Type>::~intrusive_list_t()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Link a hook between two adjacent hooks.
+         * @param hook Hook to link.
+         * @param previous Hook that will precede the linked hook.
+         * @param next Hook that will follow the linked hook.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::_link(list_hook_t *hook, list_hook_t *previous, list_hook_t *next) noexcept
+        {
+            hook->previous = previous;
+            hook->next = next;
+            previous->next = hook;
+            next->previous = hook;
+            __size++;
+        }
+
+        /**
+         * @brief Unlink a hook from its neighbours.
+         * @param hook Hook to unlink.
+         */
+        template <typename Type>
+        void intrusive_list_t<Type>::_unlink(list_hook_t *hook) noexcept
+        {
+            hook->previous->next = hook->next;
+            hook->next->previous = hook->previous;
+            hook->previous = nullptr;
+            hook->next = nullptr;
+            __size--;
+        }
+    }
+}
+
+#endif // INTRUSIVE_LIST_IMPLEMENTATION
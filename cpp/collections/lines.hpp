@@ -0,0 +1,297 @@
+#ifndef LINES_HPP
+#define LINES_HPP
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iterator> // std::input_iterator_tag
+#include <type_traits> // std::enable_if, std::is_convertible
+#include <utility> // std::declval
+
+#include "../../c/collections/string_view.h" // string_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Determine whether a contiguous container, exposing `data` and `size`, holds charactors that a range of lines can view.
+         */
+        template <typename Container, typename = void>
+        struct __lines_contiguous : std::false_type {};
+
+        template <typename Container>
+        struct __lines_contiguous<Container, decltype((void)std::declval<const Container &>().size(), (void)std::declval<const Container &>().data())>
+            : std::is_convertible<decltype(std::declval<const Container &>().data()), const char *> {};
+
+        /**
+         * @brief Non-owning range over the lines of a text. Lines end at a line feed, a carriage return before the line feed is left out of the line, and the last line does not need to end with a line feed. Every line is a `string_t` view into the text, so the text must outlive the range, and nothing is copied or allocated.
+         */
+        struct lines_t
+        {
+            public:
+                /**
+                 * @brief Input iterator over the lines of a text.
+                 */
+                struct iterator_t
+                {
+                    public:
+                        using iterator_category = std::input_iterator_tag;
+                        using value_type = string_t;
+                        using difference_type = std::ptrdiff_t;
+                        using pointer = const string_t *;
+                        using reference = const string_t &;
+
+                        /**
+                         * @brief Construct a new iterator past the last line.
+                         */
+                        iterator_t(void) noexcept;
+
+                        /**
+                         * @brief Construct a new iterator at the first line of a given text.
+                         * @param text Text over whose lines to iterate.
+                         */
+                        explicit iterator_t(string_t text) noexcept;
+
+                        /**
+                         * @brief Obtain the current line.
+                         * @returns A reference to the current line.
+                         */
+                        reference operator*(void) const noexcept;
+
+                        /**
+                         * @brief Obtain a pointer to the current line.
+                         * @returns A pointer to the current line.
+                         */
+                        pointer operator->(void) const noexcept;
+
+                        /**
+                         * @brief Advance the iterator to the next line.
+                         * @returns A reference to the iterator.
+                         */
+                        iterator_t &operator++(void) noexcept;
+
+                        /**
+                         * @brief Advance the iterator to the next line.
+                         * @returns A copy of the iterator before it was advanced.
+                         */
+                        iterator_t operator++(int) noexcept;
+
+                        /**
+                         * @brief Determine whether two iterators are at the same line. Every iterator past the last line is equal.
+                         * @param other Iterator against which to compare.
+                         * @returns True if the iterators are determined to be equal, else false.
+                         */
+                        bool operator==(const iterator_t &other) const noexcept;
+
+                        /**
+                         * @brief Determine whether two iterators are at different lines.
+                         * @param other Iterator against which to compare.
+                         * @returns True if the iterators are determined to be unequal, else false.
+                         */
+                        bool operator!=(const iterator_t &other) const noexcept;
+
+                    private:
+                        /**
+                         * @brief Text after the current line.
+                         */
+                        string_t __rest;
+
+                        /**
+                         * @brief Current line.
+                         */
+                        string_t __line;
+
+                        /**
+                         * @brief Whether the iterator is past the last line.
+                         */
+                        bool __done;
+                };
+
+                /**
+                 * @brief Construct a new range over an empty text.
+                 */
+                lines_t(void) noexcept;
+
+                /**
+                 * @brief Construct a new range over the lines of a string view.
+                 * @param text Text over whose lines to iterate.
+                 */
+                lines_t(string_t text) noexcept;
+
+                /**
+                 * @brief Construct a new range over the lines of a given number of charactors, such as a memory-mapped file.
+                 * @param data Pointer to the first charactor.
+                 * @param count Number of charactors.
+                 */
+                lines_t(const char *data, std::size_t count) noexcept;
+
+                /**
+                 * @brief Construct a new range over the lines of any contiguous container of charactors exposing `data` and `size`, such as `std::string`.
+                 * @param container Container over whose charactors to iterate.
+                 */
+                template <typename Container, typename std::enable_if<__lines_contiguous<Container>::value, int>::type = 0>
+                lines_t(const Container &container) noexcept : __text(string_new(container.data(), container.size())) {}
+
+                /**
+                 * @brief Determine if the text is empty, and so has no lines.
+                 * @returns True if the text is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept;
+
+                /**
+                 * @brief Obtain an iterator at the first line.
+                 * @returns An iterator at the first line.
+                 */
+                iterator_t begin(void) const noexcept;
+
+                /**
+                 * @brief Obtain an iterator past the last line.
+                 * @returns An iterator past the last line.
+                 */
+                iterator_t end(void) const noexcept;
+
+            protected:
+                string_t __text;
+        };
+    }
+}
+
+#endif // LINES_HPP
+
+#if defined(LINES_IMPLEMENTATION) && !defined(LINES_IMPLEMENTED)
+#define LINES_IMPLEMENTED
+
+#define STRING_VIEW_IMPLEMENTATION
+#include "../../c/collections/string_view.h"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new iterator past the last line.
+         */
+        lines_t::iterator_t::iterator_t(void) noexcept : __rest(string_new(nullptr, 0)), __line(string_new(nullptr, 0)), __done(true) {}
+
+        /**
+         * @brief Construct a new iterator at the first line of a given text.
+         * @param text Text over whose lines to iterate.
+         */
+        lines_t::iterator_t::iterator_t(string_t text) noexcept : __rest(text), __line(string_new(nullptr, 0)), __done(false)
+        {
+            ++*this;
+        }
+
+        /**
+         * @brief Obtain the current line.
+         * @returns A reference to the current line.
+         */
+        lines_t::iterator_t::reference lines_t::iterator_t::operator*(void) const noexcept
+        {
+            return __line;
+        }
+
+        /**
+         * @brief Obtain a pointer to the current line.
+         * @returns A pointer to the current line.
+         */
+        lines_t::iterator_t::pointer lines_t::iterator_t::operator->(void) const noexcept
+        {
+            return &__line;
+        }
+
+        /**
+         * @brief Advance the iterator to the next line.
+         * @returns A reference to the iterator.
+         */
+        lines_t::iterator_t &lines_t::iterator_t::operator++(void) noexcept
+        {
+            if (!string_next_line(&__rest, &__line))
+            {
+                __done = true;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Advance the iterator to the next line.
+         * @returns A copy of the iterator before it was advanced.
+         */
+        lines_t::iterator_t lines_t::iterator_t::operator++(int) noexcept
+        {
+            iterator_t copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         * @brief Determine whether two iterators are at the same line. Every iterator past the last line is equal.
+         * @param other Iterator against which to compare.
+         * @returns True if the iterators are determined to be equal, else false.
+         */
+        bool lines_t::iterator_t::operator==(const iterator_t &other) const noexcept
+        {
+            if (__done || other.__done)
+            {
+                return __done == other.__done;
+            }
+            return __rest.data == other.__rest.data && __rest.count == other.__rest.count;
+        }
+
+        /**
+         * @brief Determine whether two iterators are at different lines.
+         * @param other Iterator against which to compare.
+         * @returns True if the iterators are determined to be unequal, else false.
+         */
+        bool lines_t::iterator_t::operator!=(const iterator_t &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Construct a new range over an empty text.
+         */
+        lines_t::lines_t(void) noexcept : __text(string_new(nullptr, 0)) {}
+
+        /**
+         * @brief Construct a new range over the lines of a string view.
+         * @param text Text over whose lines to iterate.
+         */
+        lines_t::lines_t(string_t text) noexcept : __text(text) {}
+
+        /**
+         * @brief Construct a new range over the lines of a given number of charactors, such as a memory-mapped file.
+         * @param data Pointer to the first charactor.
+         * @param count Number of charactors.
+         */
+        lines_t::lines_t(const char *data, std::size_t count) noexcept : __text(string_new(data, count)) {}
+
+        /**
+         * @brief Determine if the text is empty, and so has no lines.
+         * @returns True if the text is determined to be empty, else false.
+         */
+        bool lines_t::is_empty(void) const noexcept
+        {
+            return __text.count == 0;
+        }
+
+        /**
+         * @brief Obtain an iterator at the first line.
+         * @returns An iterator at the first line.
+         */
+        lines_t::iterator_t lines_t::begin(void) const noexcept
+        {
+            return iterator_t(__text);
+        }
+
+        /**
+         * @brief Obtain an iterator past the last line.
+         * @returns An iterator past the last line.
+         */
+        lines_t::iterator_t lines_t::end(void) const noexcept
+        {
+            return iterator_t();
+        }
+    }
+}
+
+#endif // LINES_IMPLEMENTATION
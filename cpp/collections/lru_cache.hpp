@@ -0,0 +1,440 @@
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <cstddef> // std::size_t
+#include <functional> // std::function, std::hash
+#include <unordered_map> // std::unordered_map
+#include <utility> // std::move
+
+#include "intrusive_list.hpp" // list_hook_t, intrusive_list_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Cache that evicts the least recently used entry once its capacity is exceeded. Lookup, insertion, and eviction are each constant time.
+         */
+        template <typename Key, typename Value, typename Hash = std::hash<Key>>
+        struct lru_cache_t : public sized_t
+        {
+            /**
+             * @brief Callable that obtains the cost — for example the size in bytes — of an entry.
+             */
+            using cost_t = std::function<std::size_t(const Key &, const Value &)>;
+
+            public:
+                /**
+                 * @brief Construct a new cache bounded by a number of entries.
+                 * @param capacity Largest number of entries held by the cache.
+                 * @exception If the given capacity is zero, a `ValueError` is thrown.
+                 */
+                explicit lru_cache_t(std::size_t capacity);
+
+                /**
+                 * @brief Construct a new cache bounded by the total cost of its entries.
+                 * @param capacity Largest total cost of the entries held by the cache.
+                 * @param cost Callable that obtains the cost of an entry. It is called once whenever an entry is put.
+                 * @exception If the given capacity is zero, or the given cost callable is empty, a `ValueError` is thrown.
+                 */
+                lru_cache_t(std::size_t capacity, cost_t cost);
+
+                lru_cache_t(const lru_cache_t &) = delete;
+                lru_cache_t &operator=(const lru_cache_t &) = delete;
+
+                /**
+                 * @brief Obtain the value cached for a given key and mark the entry as the most recently used.
+                 * @param key Key of the entry.
+                 * @returns A mutable pointer to the cached value, or `nullptr` if the key is not cached.
+                 */
+                Value *get(const Key &key);
+
+                /**
+                 * @brief Cache a value for a given key and mark the entry as the most recently used. Least recently used entries are evicted until the cache is within its capacity. An entry whose cost alone exceeds the capacity is not cached, and any previous entry of its key is removed.
+                 * @param key Key of the entry.
+                 * @param value Value to cache.
+                 */
+                void put(const Key &key, Value value);
+
+                /**
+                 * @brief Determine if a given key is cached without marking it as used or counting a hit or miss.
+                 * @param key Key of the entry.
+                 * @returns True if the key is cached, else false.
+                 */
+                bool contains(const Key &key) const;
+
+                /**
+                 * @brief Remove the entry of a given key.
+                 * @param key Key of the entry.
+                 * @returns True if an entry was removed, else false.
+                 */
+                bool remove(const Key &key);
+
+                /**
+                 * @brief Remove every entry. The counters are left unchanged.
+                 */
+                void clear(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of lookups that found a cached value.
+                 * @returns The number of hits.
+                 */
+                std::size_t hits(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of lookups that did not find a cached value.
+                 * @returns The number of misses.
+                 */
+                std::size_t misses(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of entries evicted to stay within the capacity.
+                 * @returns The number of evictions.
+                 */
+                std::size_t evictions(void) const noexcept;
+
+                /**
+                 * @brief Obtain the total cost of every cached entry. When the cache is bounded by a number of entries, each entry costs one.
+                 * @returns The total cost of the cache.
+                 */
+                std::size_t cost(void) const noexcept;
+
+                /**
+                 * @brief Obtain the capacity of the cache.
+                 * @returns The largest total cost held by the cache.
+                 */
+                std::size_t capacity(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of cached entries.
+                 * @returns The size of the cache.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the cache is empty.
+                 * @returns True if the cache is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the cache is full.
+                 * @returns True if the total cost of the cache has reached its capacity.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Destructor to deallocate every entry.
+                 */
+                virtual ~lru_cache_t();
+
+            protected:
+                /**
+                 * @brief Entry of the cache, linked into the recency list.
+                 */
+                struct node_t : public list_hook_t
+                {
+                    node_t(const Key &key, Value value, std::size_t cost) : list_hook_t(), key(key), value(std::move(value)), cost(cost) {}
+
+                    Key key;
+                    Value value;
+                    std::size_t cost;
+                };
+
+                /**
+                 * @brief Unlink, unindex, and deallocate a given entry.
+                 * @param node Entry to erase.
+                 */
+                void _erase(node_t *node);
+
+                /**
+                 * @brief Evict least recently used entries until the cache is within its capacity.
+                 */
+                void _evict(void);
+
+            protected:
+                std::unordered_map<Key, node_t *, Hash> __index;
+                intrusive_list_t<node_t> __recency;
+                cost_t __cost_of;
+                std::size_t __capacity;
+                std::size_t __cost;
+                std::size_t __hits;
+                std::size_t __misses;
+                std::size_t __evictions;
+        };
+    }
+}
+
+#endif // LRU_CACHE_HPP
+
+#if defined(LRU_CACHE_IMPLEMENTATION) && !defined(LRU_CACHE_IMPLEMENTED)
+#define LRU_CACHE_IMPLEMENTED
+
+#define INTRUSIVE_LIST_IMPLEMENTATION
+#include "intrusive_list.hpp"
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new cache bounded by a number of entries.
+         * @param capacity Largest number of entries held by the cache.
+         * @exception If the given capacity is zero, a `ValueError` is thrown.
+         */
+        template <typename Key, typename Value, typename Hash>
+        lru_cache_t<Key, Value, Hash>::lru_cache_t(std::size_t capacity) : __index(), __recency(), __cost_of(), __capacity(capacity), __cost(0), __hits(0), __misses(0), __evictions(0)
+        {
+            if (0 == capacity)
+            {
+                throw ValueError("Can not construct a cache with a capacity of zero.");
+            }
+            __index.reserve(capacity);
+        }
+
+        /**
+         * @brief Construct a new cache bounded by the total cost of its entries.
+         * @param capacity Largest total cost of the entries held by the cache.
+         * @param cost Callable that obtains the cost of an entry. It is called once whenever an entry is put.
+         * @exception If the given capacity is zero, or the given cost callable is empty, a `ValueError` is thrown.
+         */
+        template <typename Key, typename Value, typename Hash>
+        lru_cache_t<Key, Value, Hash>::lru_cache_t(std::size_t capacity, cost_t cost) : __index(), __recency(), __cost_of(std::move(cost)), __capacity(capacity), __cost(0), __hits(0), __misses(0), __evictions(0)
+        {
+            if (0 == capacity)
+            {
+                throw ValueError("Can not construct a cache with a capacity of zero.");
+            }
+            else if (!__cost_of)
+            {
+                throw ValueError("Can not construct a cache with an empty cost callable.");
+            }
+        }
+
+        /**
+         * @brief Obtain the value cached for a given key and mark the entry as the most recently used.
+         * @param key Key of the entry.
+         * @returns A mutable pointer to the cached value, or `nullptr` if the key is not cached.
+         */
+        template <typename Key, typename Value, typename Hash>
+        Value *lru_cache_t<Key, Value, Hash>::get(const Key &key)
+        {
+            auto found = __index.find(key);
+            if (found == __index.end())
+            {
+                __misses++;
+                return nullptr;
+            }
+            __hits++;
+            __recency.move_to_front(*found->second);
+            return &found->second->value;
+        }
+
+        /**
+         * @brief Cache a value for a given key and mark the entry as the most recently used. Least recently used entries are evicted until the cache is within its capacity. An entry whose cost alone exceeds the capacity is not cached, and any previous entry of its key is removed.
+         * @param key Key of the entry.
+         * @param value Value to cache.
+         */
+        template <typename Key, typename Value, typename Hash>
+        void lru_cache_t<Key, Value, Hash>::put(const Key &key, Value value)
+        {
+            const std::size_t cost = __cost_of ? __cost_of(key, value) : 1;
+            auto found = __index.find(key);
+            if (cost > __capacity)
+            {
+                // Retaining the entry would evict the whole cache and then the entry itself.
+                if (found != __index.end())
+                {
+                    _erase(found->second);
+                }
+                return;
+            }
+            if (found != __index.end())
+            {
+                node_t *node = found->second;
+                __cost = __cost - node->cost + cost;
+                node->value = std::move(value);
+                node->cost = cost;
+                __recency.move_to_front(*node);
+            }
+            else
+            {
+                node_t *node = new node_t(key, std::move(value), cost);
+                try
+                {
+                    __index.emplace(key, node);
+                }
+                catch (...)
+                {
+                    delete node;
+                    throw;
+                }
+                __recency.push_front(*node);
+                __cost += cost;
+            }
+            _evict();
+        }
+
+        /**
+         * @brief Determine if a given key is cached without marking it as used or counting a hit or miss.
+         * @param key Key of the entry.
+         * @returns True if the key is cached, else false.
+         */
+        template <typename Key, typename Value, typename Hash>
+        bool lru_cache_t<Key, Value, Hash>::contains(const Key &key) const
+        {
+            return __index.find(key) != __index.end();
+        }
+
+        /**
+         * @brief Remove the entry of a given key.
+         * @param key Key of the entry.
+         * @returns True if an entry was removed, else false.
+         */
+        template <typename Key, typename Value, typename Hash>
+        bool lru_cache_t<Key, Value, Hash>::remove(const Key &key)
+        {
+            auto found = __index.find(key);
+            if (found == __index.end())
+            {
+                return false;
+            }
+            _erase(found->second);
+            return true;
+        }
+
+        /**
+         * @brief Remove every entry. The counters are left unchanged.
+         */
+        template <typename Key, typename Value, typename Hash>
+        void lru_cache_t<Key, Value, Hash>::clear(void) noexcept
+        {
+            while (!__recency.is_empty())
+            {
+                delete __recency.pop_back();
+            }
+            __index.clear();
+            __cost = 0;
+        }
+
+        /**
+         * @brief Obtain the number of lookups that found a cached value.
+         * @returns The number of hits.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::hits(void) const noexcept
+        {
+            return __hits;
+        }
+
+        /**
+         * @brief Obtain the number of lookups that did not find a cached value.
+         * @returns The number of misses.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::misses(void) const noexcept
+        {
+            return __misses;
+        }
+
+        /**
+         * @brief Obtain the number of entries evicted to stay within the capacity.
+         * @returns The number of evictions.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::evictions(void) const noexcept
+        {
+            return __evictions;
+        }
+
+        /**
+         * @brief Obtain the total cost of every cached entry. When the cache is bounded by a number of entries, each entry costs one.
+         * @returns The total cost of the cache.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::cost(void) const noexcept
+        {
+            return __cost;
+        }
+
+        /**
+         * @brief Obtain the capacity of the cache.
+         * @returns The largest total cost held by the cache.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::capacity(void) const noexcept
+        {
+            return __capacity;
+        }
+
+        /**
+         * @brief Obtain the number of cached entries.
+         * @returns The size of the cache.
+         */
+        template <typename Key, typename Value, typename Hash>
+        std::size_t lru_cache_t<Key, Value, Hash>::size(void) const noexcept
+        {
+            return __index.size();
+        }
+
+        /**
+         * @brief Determine if the cache is empty.
+         * @returns True if the cache is determined to be empty, else false.
+         */
+        template <typename Key, typename Value, typename Hash>
+        bool lru_cache_t<Key, Value, Hash>::is_empty(void) const noexcept
+        {
+            return __index.empty();
+        }
+
+        /**
+         * @brief Determine if the cache is full.
+         * @returns True if the total cost of the cache has reached its capacity.
+         */
+        template <typename Key, typename Value, typename Hash>
+        bool lru_cache_t<Key, Value, Hash>::is_full(void) const noexcept
+        {
+            return __cost >= __capacity;
+        }
+
+        /**
+         * @brief Destructor to deallocate every entry.
+         */
+        template <typename Key, typename Value, typename Hash>
+        lru_cache_t<Key, Value, Hash>::~lru_cache_t()
+        {
+            clear();
+        }
+
+        /**
+         * @brief Unlink, unindex, and deallocate a given entry.
+         * @param node Entry to erase.
+         */
+        template <typename Key, typename Value, typename Hash>
+        void lru_cache_t<Key, Value, Hash>::_erase(node_t *node)
+        {
+            __recency.remove(*node);
+            __index.erase(node->key);
+            __cost -= node->cost;
+            delete node;
+        }
+
+        /**
+         * @brief Evict least recently used entries until the cache is within its capacity.
+         */
+        template <typename Key, typename Value, typename Hash>
+        void lru_cache_t<Key, Value, Hash>::_evict(void)
+        {
+            while (__cost > __capacity && !__recency.is_empty())
+            {
+                _erase(__recency.back());
+                __evictions++;
+            }
+        }
+    }
+}
+
+#endif // LRU_CACHE_IMPLEMENTATION
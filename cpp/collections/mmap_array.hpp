@@ -0,0 +1,516 @@
+#ifndef MMAP_ARRAY_HPP
+#define MMAP_ARRAY_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t, SIZE_MAX
+#include <string> // std::string
+#include <type_traits> // std::is_trivially_copyable
+
+#include "collection.hpp" // collection_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Access pattern hint given to the operating system for a mapped array.
+         */
+        enum class advice_t
+        {
+            NORMAL,
+            SEQUENTIAL,
+            RANDOM,
+            WILLNEED,
+            DONTNEED,
+        };
+
+        /**
+         * @brief Dynamic array whose storage is a memory-mapped file. The items persist within the file between runs of the programme.
+         */
+        template <typename Type>
+        struct mmap_array_t : public collection_t<Type>
+        {
+            static_assert(std::is_trivially_copyable<Type>::value, "The type of a memory-mapped array must be trivially copyable.");
+
+            public:
+                /**
+                 * @brief Open — or create — a memory-mapped array stored within a file at a given path.
+                 * @param path Path of the backing file.
+                 * @exception If the file can not be opened, resized, or mapped, an `IOError` is thrown.
+                 * @exception If the file was not written by a memory-mapped array of the same type size, a `ValueError` is thrown.
+                 */
+                explicit mmap_array_t(const std::string &path);
+
+                /**
+                 * @brief Open — or create — a memory-mapped array stored within a file at a given path with a given minimum capacity.
+                 * @param path Path of the backing file.
+                 * @param capacity Minimum number of items the file can hold before being grown.
+                 * @exception If the file can not be opened, resized, or mapped, an `IOError` is thrown.
+                 * @exception If the file was not written by a memory-mapped array of the same type size, a `ValueError` is thrown.
+                 */
+                mmap_array_t(const std::string &path, std::size_t capacity);
+
+                mmap_array_t(const mmap_array_t &) = delete;
+                mmap_array_t &operator=(const mmap_array_t &) = delete;
+
+                /**
+                 * @brief Append an item to the array. If the array is full, the backing file is grown by a factor of two and remapped.
+                 * @param item Item to be appended.
+                 * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+                 */
+                void append(Type item) override;
+
+                /**
+                 * @brief Obtain a mutable pointer to an item at a given index within the array. The pointer is invalidated when the array grows.
+                 * @param index Index at which the item is located.
+                 * @exception If the array is evaluated to be empty, a `ValueError` is thrown.
+                 * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+                 */
+                Type *at(std::size_t index) const override;
+
+                /**
+                 * @brief Remove an item from the array at a given index.
+                 * @param index Index at which the item is located.
+                 * @exception If the array is evaluated to be empty, a `ValueError` is thrown.
+                 * @exception If the given index is greater than or equal to the size of the array, an `OutOfRangeError` is thrown.
+                 */
+                void remove(std::size_t index) override;
+
+                /**
+                 * @brief Ensure the backing file can hold at least a given number of items.
+                 * @param capacity Minimum capacity of the array.
+                 * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+                 */
+                void reserve(std::size_t capacity);
+
+                /**
+                 * @brief Flush every modified page of the mapping to the backing file, blocking until the write has completed.
+                 * @exception If the mapping can not be flushed, an `IOError` is thrown.
+                 */
+                void sync(void) const;
+
+                /**
+                 * @brief Advise the operating system of how the array is about to be accessed. The hint may be ignored.
+                 * @param advice Expected access pattern.
+                 * @exception If the advice is rejected by the operating system, an `IOError` is thrown.
+                 */
+                void advise(advice_t advice) const;
+
+                /**
+                 * @brief Obtain the size of the array.
+                 * @returns The number of items stored within the array.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Obtain the number of items the backing file can hold before being grown.
+                 * @returns The capacity of the array.
+                 */
+                std::size_t capacity(void) const noexcept;
+
+                /**
+                 * @brief Determine if the array is empty.
+                 * @returns True if the array is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is full.
+                 * @returns True if the size of the array is greater than or equal to its capacity.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Unmap the array and close the backing file. Unflushed pages are still written back by the operating system.
+                 */
+                virtual ~mmap_array_t();
+
+            protected:
+                /**
+                 * @brief Header stored at the beginning of the backing file.
+                 */
+                struct header_t
+                {
+                    std::uint64_t magic;
+                    std::uint64_t item_size;
+                    std::uint64_t size;
+                };
+
+                /**
+                 * @brief Grow the backing file to hold a given number of items and remap it.
+                 * @param capacity Number of items the backing file must be able to hold.
+                 * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+                 */
+                void _remap(std::size_t capacity);
+
+                /**
+                 * @brief Unmap the array and close the backing file.
+                 */
+                void _delete(void) noexcept;
+
+            protected:
+                int __descriptor;
+                void *__mapping;
+                std::size_t __length;
+                header_t *__header;
+                Type *__items;
+                std::size_t __capacity;
+        };
+    }
+}
+
+#endif // MMAP_ARRAY_HPP
+
+#if defined(MMAP_ARRAY_IMPLEMENTATION) && !defined(MMAP_ARRAY_IMPLEMENTED)
+#define MMAP_ARRAY_IMPLEMENTED
+
+#ifdef _WIN32
+#error "The memory-mapped array is only implemented for POSIX systems."
+#endif // _WIN32
+
+#include <cstring> // std::memmove, std::strerror
+#include <cerrno> // errno
+#include <limits> // std::numeric_limits
+
+#include <fcntl.h> // open, O_RDWR, O_CREAT
+#include <unistd.h> // close, ftruncate, pread
+#include <sys/mman.h> // mmap, mremap, munmap, msync, madvise
+#include <sys/stat.h> // fstat, struct stat
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+#ifndef MMAP_ARRAY_CAPACITY
+#define MMAP_ARRAY_CAPACITY 256
+#endif // MMAP_ARRAY_CAPACITY
+
+namespace
+{
+    /**
+     * @brief Value identifying a file written by a memory-mapped array.
+     */
+    constexpr std::uint64_t __MMAP_ARRAY_MAGIC = 0x59415252414D4D50ULL;
+
+    /**
+     * @brief Offset — in bytes — of the first item within the backing file. Large enough to keep any item type aligned.
+     */
+    constexpr std::size_t __MMAP_ARRAY_OFFSET = 64;
+
+    /**
+     * @brief Convert an access pattern hint into its `madvise` flag.
+     * @param advice Access pattern hint.
+     * @returns The equivalent `madvise` flag.
+     */
+    inline int __mmap_array_advice(polutils::collections::advice_t advice) noexcept
+    {
+        switch (advice)
+        {
+            case polutils::collections::advice_t::SEQUENTIAL:
+            {
+                return MADV_SEQUENTIAL;
+            }
+            case polutils::collections::advice_t::RANDOM:
+            {
+                return MADV_RANDOM;
+            }
+            case polutils::collections::advice_t::WILLNEED:
+            {
+                return MADV_WILLNEED;
+            }
+            case polutils::collections::advice_t::DONTNEED:
+            {
+                return MADV_DONTNEED;
+            }
+            default:
+            {
+                return MADV_NORMAL;
+            }
+        }
+    }
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Open — or create — a memory-mapped array stored within a file at a given path.
+         * @param path Path of the backing file.
+         * @exception If the file can not be opened, resized, or mapped, an `IOError` is thrown.
+         * @exception If the file was not written by a memory-mapped array of the same type size, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        mmap_array_t<Type>::mmap_array_t(const std::string &path) : mmap_array_t(path, MMAP_ARRAY_CAPACITY) {}
+
+        /**
+         * @brief Open — or create — a memory-mapped array stored within a file at a given path with a given minimum capacity.
+         * @param path Path of the backing file.
+         * @param capacity Minimum number of items the file can hold before being grown.
+         * @exception If the file can not be opened, resized, or mapped, an `IOError` is thrown.
+         * @exception If the file was not written by a memory-mapped array of the same type size, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        mmap_array_t<Type>::mmap_array_t(const std::string &path, std::size_t capacity) : __descriptor(-1), __mapping(nullptr), __length(0), __header(nullptr), __items(nullptr), __capacity(0)
+        {
+            __descriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (__descriptor < 0)
+            {
+                throw IOError("Can not open file '%s': %s.", path.c_str(), std::strerror(errno));
+            }
+            struct stat stat_buffer = {};
+            if (fstat(__descriptor, &stat_buffer) < 0)
+            {
+                _delete();
+                throw IOError("Can not stat file '%s': %s.", path.c_str(), std::strerror(errno));
+            }
+            const std::size_t length = static_cast<std::size_t>(stat_buffer.st_size);
+            const bool created = length == 0;
+            header_t header = {__MMAP_ARRAY_MAGIC, sizeof(Type), 0};
+            if (!created)
+            {
+                // The header is validated before the file is touched so that a foreign file is never resized.
+                if (length < __MMAP_ARRAY_OFFSET || pread(__descriptor, &header, sizeof(header_t), 0) != static_cast<ssize_t>(sizeof(header_t)) || header.magic != __MMAP_ARRAY_MAGIC || header.item_size != sizeof(Type) || header.size > (length - __MMAP_ARRAY_OFFSET) / sizeof(Type))
+                {
+                    _delete();
+                    throw ValueError("File '%s' is not a memory-mapped array of items of size %zu.", path.c_str(), sizeof(Type));
+                }
+            }
+            const std::size_t existing = created ? 0 : (length - __MMAP_ARRAY_OFFSET) / sizeof(Type);
+            try
+            {
+                _remap(existing > capacity ? existing : (capacity == 0 ? 1 : capacity));
+            }
+            catch (...)
+            {
+                _delete();
+                throw;
+            }
+            if (created)
+            {
+                *__header = header;
+            }
+        }
+
+        /**
+         * @brief Append an item to the array. If the array is full, the backing file is grown by a factor of two and remapped.
+         * @param item Item to be appended.
+         * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::append(Type item)
+        {
+            if (is_full())
+            {
+                _remap(__capacity > SIZE_MAX / 2 ? SIZE_MAX : __capacity * 2);
+            }
+            __items[__header->size++] = item;
+        }
+
+        /**
+         * @brief Obtain a mutable pointer to an item at a given index within the array. The pointer is invalidated when the array grows.
+         * @param index Index at which the item is located.
+         * @exception If the array is evaluated to be empty, a `ValueError` is thrown.
+         * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        Type *mmap_array_t<Type>::at(std::size_t index) const
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not access an element of an empty memory-mapped array.");
+            }
+            else if (index >= size())
+            {
+                throw IndexError("Can not access element %zu of a memory-mapped array of size %zu.", index, size());
+            }
+            return &__items[index];
+        }
+
+        /**
+         * @brief Remove an item from the array at a given index.
+         * @param index Index at which the item is located.
+         * @exception If the array is evaluated to be empty, a `ValueError` is thrown.
+         * @exception If the given index is greater than or equal to the size of the array, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::remove(std::size_t index)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not remove an element from an empty memory-mapped array.");
+            }
+            else if (index >= size())
+            {
+                throw OutOfRangeError("Can not access element outside of memory-mapped array bounds.");
+            }
+            std::memmove(__items + index, __items + index + 1, (size() - index - 1) * sizeof(Type));
+            __header->size--;
+        }
+
+        /**
+         * @brief Ensure the backing file can hold at least a given number of items.
+         * @param capacity Minimum capacity of the array.
+         * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::reserve(std::size_t capacity)
+        {
+            if (capacity <= __capacity)
+            {
+                return;
+            }
+            _remap(capacity);
+        }
+
+        /**
+         * @brief Flush every modified page of the mapping to the backing file, blocking until the write has completed.
+         * @exception If the mapping can not be flushed, an `IOError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::sync(void) const
+        {
+            if (msync(__mapping, __length, MS_SYNC) < 0)
+            {
+                throw IOError("Can not flush memory-mapped array: %s.", std::strerror(errno));
+            }
+        }
+
+        /**
+         * @brief Advise the operating system of how the array is about to be accessed. The hint may be ignored.
+         * @param advice Expected access pattern.
+         * @exception If the advice is rejected by the operating system, an `IOError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::advise(advice_t advice) const
+        {
+            if (madvise(__mapping, __length, __mmap_array_advice(advice)) < 0)
+            {
+                throw IOError("Can not advise memory-mapped array: %s.", std::strerror(errno));
+            }
+        }
+
+        /**
+         * @brief Obtain the size of the array.
+         * @returns The number of items stored within the array.
+         */
+        template <typename Type>
+        std::size_t mmap_array_t<Type>::size(void) const noexcept
+        {
+            return nullptr == __header ? 0 : static_cast<std::size_t>(__header->size);
+        }
+
+        /**
+         * @brief Obtain the number of items the backing file can hold before being grown.
+         * @returns The capacity of the array.
+         */
+        template <typename Type>
+        std::size_t mmap_array_t<Type>::capacity(void) const noexcept
+        {
+            return __capacity;
+        }
+
+        /**
+         * @brief Determine if the array is empty.
+         * @returns True if the array is determined to be empty, else false.
+         */
+        template <typename Type>
+        bool mmap_array_t<Type>::is_empty(void) const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Determine if the array is full.
+         * @returns True if the size of the array is greater than or equal to its capacity.
+         */
+        template <typename Type>
+        bool mmap_array_t<Type>::is_full(void) const noexcept
+        {
+            return size() >= __capacity;
+        }
+
+        /**
+         * @brief Grow the backing file to hold a given number of items and remap it.
+         * @param capacity Number of items the backing file must be able to hold.
+         * @exception If the backing file can not be grown or remapped, an `IOError` is thrown.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::_remap(std::size_t capacity)
+        {
+            // The length of the file must fit both within a size and within a file offset.
+            if (capacity > (SIZE_MAX - __MMAP_ARRAY_OFFSET) / sizeof(Type) || __MMAP_ARRAY_OFFSET + capacity * sizeof(Type) > static_cast<std::uint64_t>(std::numeric_limits<off_t>::max()))
+            {
+                throw IOError("Can not grow memory-mapped array to %zu items of size %zu.", capacity, sizeof(Type));
+            }
+            const std::size_t length = __MMAP_ARRAY_OFFSET + capacity * sizeof(Type);
+            struct stat stat_buffer = {};
+            if (fstat(__descriptor, &stat_buffer) < 0)
+            {
+                throw IOError("Can not stat memory-mapped array: %s.", std::strerror(errno));
+            }
+            if (static_cast<std::size_t>(stat_buffer.st_size) < length && ftruncate(__descriptor, static_cast<off_t>(length)) < 0)
+            {
+                throw IOError("Can not grow memory-mapped array to %zu bytes: %s.", length, std::strerror(errno));
+            }
+            void *mapping = MAP_FAILED;
+            if (nullptr == __mapping)
+            {
+                mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, __descriptor, 0);
+            }
+            else
+            {
+            #if defined(__linux__) && defined(MREMAP_MAYMOVE)
+                mapping = mremap(__mapping, __length, length, MREMAP_MAYMOVE);
+            #else
+                mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, __descriptor, 0);
+                if (mapping != MAP_FAILED)
+                {
+                    munmap(__mapping, __length);
+                }
+            #endif // __linux__
+            }
+            if (mapping == MAP_FAILED)
+            {
+                throw IOError("Can not map memory-mapped array of %zu bytes: %s.", length, std::strerror(errno));
+            }
+            __mapping = mapping;
+            __length = length;
+            __header = static_cast<header_t *>(mapping);
+            __items = reinterpret_cast<Type *>(static_cast<char *>(mapping) + __MMAP_ARRAY_OFFSET);
+            __capacity = capacity;
+        }
+
+        /**
+         * @brief Unmap the array and close the backing file.
+         */
+        template <typename Type>
+        void mmap_array_t<Type>::_delete(void) noexcept
+        {
+            if (nullptr != __mapping)
+            {
+                munmap(__mapping, __length);
+                __mapping = nullptr;
+            }
+            if (__descriptor >= 0)
+            {
+                close(__descriptor);
+                __descriptor = -1;
+            }
+            __header = nullptr;
+            __items = nullptr;
+            __length = 0;
+            __capacity = 0;
+        }
+
+        /**
+         * @brief Unmap the array and close the backing file. Unflushed pages are still written back by the operating system.
+         */
+        template <typename Type>
+        mmap_array_t<Type>::~mmap_array_t()
+        {
+            _delete();
+        }
+    }
+}
+
+#endif // MMAP_ARRAY_IMPLEMENTATION
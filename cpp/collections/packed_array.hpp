@@ -0,0 +1,634 @@
+#ifndef PACKED_ARRAY_HPP
+#define PACKED_ARRAY_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <vector> // std::vector
+
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Compressed array of 64-bit unsigned integers. Values are grouped into blocks of 128; each block stores its minimum once and every value as its distance from that minimum, packed into just enough bits for the largest distance. The last, incomplete block is kept unpacked until it fills.
+         */
+        struct packed_array_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Construct a new empty array.
+                 */
+                packed_array_t(void) noexcept;
+
+                /**
+                 * @brief Append a value to the array.
+                 * @param value Value to append.
+                 */
+                void append(std::uint64_t value);
+
+                /**
+                 * @brief Obtain the value at a given index.
+                 * @param index Index at which the value is located.
+                 * @returns The value at the given index.
+                 * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+                 */
+                std::uint64_t at(std::size_t index) const;
+
+                /**
+                 * @brief Decode a range of values. Whole blocks are unpacked directly into the output.
+                 * @param index Index of the first value to decode.
+                 * @param count Number of values to decode.
+                 * @param output Pointer to at least `count` values, into which the values are written.
+                 * @exception If the range extends past the size of the array, an `IndexError` is thrown.
+                 */
+                void decode(std::size_t index, std::size_t count, std::uint64_t *output) const;
+
+                /**
+                 * @brief Obtain the number of values within the array.
+                 * @returns The size of the array.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is empty.
+                 * @returns True if the array is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is full. A packed array is never full.
+                 * @returns False.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Estimate the memory used by the values of the array.
+                 * @returns The number of bytes used by the packed words, the block headers, and the unpacked tail.
+                 */
+                std::size_t size_in_bytes(void) const noexcept;
+
+            protected:
+                /**
+                 * @brief Header of a packed block.
+                 */
+                struct block_t
+                {
+                    std::uint64_t base;
+                    std::size_t offset;
+                    std::uint8_t width;
+                };
+
+                /**
+                 * @brief Pack the unpacked tail into a new block.
+                 */
+                void _seal(void);
+
+            protected:
+                std::vector<std::uint64_t> __words;
+                std::vector<block_t> __blocks;
+                std::vector<std::uint64_t> __tail;
+        };
+
+        /**
+         * @brief Compressed array of sorted 64-bit unsigned integers. Values are grouped into blocks of 128; each block stores its first value once and every following value as its difference from the previous one, encoded as a variable-length integer of seven bits per byte.
+         */
+        struct delta_array_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Construct a new empty array.
+                 */
+                delta_array_t(void) noexcept;
+
+                /**
+                 * @brief Append a value to the array.
+                 * @param value Value to append. The value must not be less than the last value within the array.
+                 * @exception If the value is less than the last value within the array, a `ValueError` is thrown.
+                 */
+                void append(std::uint64_t value);
+
+                /**
+                 * @brief Obtain the value at a given index. The block holding the value is decoded up to the index.
+                 * @param index Index at which the value is located.
+                 * @returns The value at the given index.
+                 * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+                 */
+                std::uint64_t at(std::size_t index) const;
+
+                /**
+                 * @brief Decode a range of values.
+                 * @param index Index of the first value to decode.
+                 * @param count Number of values to decode.
+                 * @param output Pointer to at least `count` values, into which the values are written.
+                 * @exception If the range extends past the size of the array, an `IndexError` is thrown.
+                 */
+                void decode(std::size_t index, std::size_t count, std::uint64_t *output) const;
+
+                /**
+                 * @brief Obtain the number of values within the array.
+                 * @returns The size of the array.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is empty.
+                 * @returns True if the array is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the array is full. A delta array is never full.
+                 * @returns False.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Estimate the memory used by the values of the array.
+                 * @returns The number of bytes used by the encoded differences and the block headers.
+                 */
+                std::size_t size_in_bytes(void) const noexcept;
+
+            protected:
+                /**
+                 * @brief Header of an encoded block.
+                 */
+                struct block_t
+                {
+                    std::uint64_t first;
+                    std::size_t offset;
+                };
+
+            protected:
+                std::vector<std::uint8_t> __bytes;
+                std::vector<block_t> __blocks;
+                std::uint64_t __last;
+                std::size_t __size;
+        };
+    }
+}
+
+#endif // PACKED_ARRAY_HPP
+
+#if defined(PACKED_ARRAY_IMPLEMENTATION) && !defined(PACKED_ARRAY_IMPLEMENTED)
+#define PACKED_ARRAY_IMPLEMENTED
+
+#include <cstring> // std::memcpy
+
+#ifndef PACKED_ARRAY_AVX2
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define PACKED_ARRAY_AVX2 1
+#else
+#define PACKED_ARRAY_AVX2 0
+#endif
+#endif // PACKED_ARRAY_AVX2
+
+#if PACKED_ARRAY_AVX2
+#include <immintrin.h> // __m256i, _mm256_i64gather_epi64, _mm256_srlv_epi64, _mm256_sllv_epi64
+#endif // PACKED_ARRAY_AVX2
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace
+{
+    /**
+     * @brief Number of values within a block.
+     */
+    constexpr std::size_t __PACKED_ARRAY_BLOCK = 128;
+
+    /**
+     * @brief Obtain the number of bits needed to hold a given value.
+     * @param value Value to measure.
+     * @returns The number of significant bits of the value.
+     */
+    inline std::uint8_t __packed_width(std::uint64_t value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 0 == value ? 0 : static_cast<std::uint8_t>(64 - __builtin_clzll(value));
+#else
+        std::uint8_t width = 0;
+        while (value)
+        {
+            width++;
+            value >>= 1;
+        }
+        return width;
+#endif
+    }
+
+    /**
+     * @brief Obtain the number of words holding a packed block. One extra word is always present so that the kernels may read past the last value without a branch.
+     * @param count Number of values within the block.
+     * @param width Number of bits per value.
+     * @returns The number of words.
+     */
+    inline std::size_t __packed_words(std::size_t count, std::uint8_t width) noexcept
+    {
+        // With a width of zero every value reads the first word and the one after it.
+        return 0 == width ? 2 : (count * width + 63) / 64 + 1;
+    }
+
+    /**
+     * @brief Pack values as distances from a base. The words must be zeroed beforehand.
+     * @param values Pointer to the first value.
+     * @param count Number of values.
+     * @param base Value from which every distance is measured.
+     * @param width Number of bits per distance.
+     * @param words Pointer to the words into which to pack.
+     */
+    inline void __packed_pack(const std::uint64_t *values, std::size_t count, std::uint64_t base, std::uint8_t width, std::uint64_t *words) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t delta = values[i] - base;
+            const std::size_t bit = i * width;
+            const unsigned shift = static_cast<unsigned>(bit & 63);
+            words[bit >> 6] |= delta << shift;
+            // Shifting in two steps keeps a shift of zero from becoming an undefined shift of 64.
+            words[(bit >> 6) + 1] |= (delta >> 1) >> (63 - shift);
+        }
+    }
+
+    /**
+     * @brief Unpack values from their distances to a base, one value at a time.
+     * @param words Pointer to the packed words.
+     * @param count Number of values.
+     * @param base Value from which every distance is measured.
+     * @param width Number of bits per distance.
+     * @param output Pointer to the values into which to unpack.
+     */
+    inline void __packed_unpack_scalar(const std::uint64_t *words, std::size_t count, std::uint64_t base, std::uint8_t width, std::uint64_t *output) noexcept
+    {
+        const std::uint64_t mask = width >= 64 ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << width) - 1;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t bit = i * width;
+            const unsigned shift = static_cast<unsigned>(bit & 63);
+            const std::uint64_t low = words[bit >> 6] >> shift;
+            const std::uint64_t high = (words[(bit >> 6) + 1] << 1) << (63 - shift);
+            output[i] = base + ((low | high) & mask);
+        }
+    }
+
+#if PACKED_ARRAY_AVX2
+    /**
+     * @brief Unpack values from their distances to a base, four values at a time. Each lane gathers the two words its value may straddle and shifts them by its own amount.
+     * @param words Pointer to the packed words.
+     * @param count Number of values.
+     * @param base Value from which every distance is measured.
+     * @param width Number of bits per distance.
+     * @param output Pointer to the values into which to unpack.
+     */
+    __attribute__((target("avx2"))) inline void __packed_unpack_avx2(const std::uint64_t *words, std::size_t count, std::uint64_t base, std::uint8_t width, std::uint64_t *output) noexcept
+    {
+        const std::uint64_t scalar_mask = width >= 64 ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << width) - 1;
+        const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(scalar_mask));
+        const __m256i bases = _mm256_set1_epi64x(static_cast<long long>(base));
+        const __m256i step = _mm256_set1_epi64x(4 * static_cast<long long>(width));
+        const __m256i low_bits = _mm256_set1_epi64x(63);
+        const __m256i word_bits = _mm256_set1_epi64x(64);
+        __m256i bits = _mm256_setr_epi64x(0, width, 2 * static_cast<long long>(width), 3 * static_cast<long long>(width));
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m256i index = _mm256_srli_epi64(bits, 6);
+            const __m256i shift = _mm256_and_si256(bits, low_bits);
+            const __m256i low = _mm256_srlv_epi64(_mm256_i64gather_epi64(reinterpret_cast<const long long *>(words), index, 8), shift);
+            // A variable shift of 64 yields zero, so a value that does not straddle two words takes nothing from the second.
+            const __m256i high = _mm256_sllv_epi64(_mm256_i64gather_epi64(reinterpret_cast<const long long *>(words + 1), index, 8), _mm256_sub_epi64(word_bits, shift));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), _mm256_add_epi64(bases, _mm256_and_si256(_mm256_or_si256(low, high), mask)));
+            bits = _mm256_add_epi64(bits, step);
+        }
+        for (; i < count; ++i)
+        {
+            const std::size_t bit = i * width;
+            const unsigned shift = static_cast<unsigned>(bit & 63);
+            output[i] = base + (((words[bit >> 6] >> shift) | ((words[(bit >> 6) + 1] << 1) << (63 - shift))) & scalar_mask);
+        }
+    }
+#endif // PACKED_ARRAY_AVX2
+
+    /**
+     * @brief Unpack values from their distances to a base, using the widest kernel the processor supports.
+     * @param words Pointer to the packed words.
+     * @param count Number of values.
+     * @param base Value from which every distance is measured.
+     * @param width Number of bits per distance.
+     * @param output Pointer to the values into which to unpack.
+     */
+    inline void __packed_unpack(const std::uint64_t *words, std::size_t count, std::uint64_t base, std::uint8_t width, std::uint64_t *output) noexcept
+    {
+#if PACKED_ARRAY_AVX2
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        if (avx2)
+        {
+            __packed_unpack_avx2(words, count, base, width, output);
+            return;
+        }
+#endif // PACKED_ARRAY_AVX2
+        __packed_unpack_scalar(words, count, base, width, output);
+    }
+
+    /**
+     * @brief Append a value as a variable-length integer of seven bits per byte.
+     * @param bytes Bytes to which to append.
+     * @param value Value to encode.
+     */
+    inline void __varint_encode(std::vector<std::uint8_t> &bytes, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    /**
+     * @brief Read a variable-length integer of seven bits per byte.
+     * @param bytes Pointer to the first byte; advanced past the integer.
+     * @returns The decoded value.
+     */
+    inline std::uint64_t __varint_decode(const std::uint8_t *&bytes) noexcept
+    {
+        std::uint64_t value = 0;
+        unsigned shift = 0;
+        while (*bytes & 0x80)
+        {
+            value |= static_cast<std::uint64_t>(*bytes++ & 0x7F) << shift;
+            shift += 7;
+        }
+        return value | (static_cast<std::uint64_t>(*bytes++) << shift);
+    }
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty array.
+         */
+        packed_array_t::packed_array_t(void) noexcept : __words(), __blocks(), __tail() {}
+
+        /**
+         * @brief Append a value to the array.
+         * @param value Value to append.
+         */
+        void packed_array_t::append(std::uint64_t value)
+        {
+            __tail.push_back(value);
+            if (__tail.size() == __PACKED_ARRAY_BLOCK)
+            {
+                _seal();
+            }
+        }
+
+        /**
+         * @brief Obtain the value at a given index.
+         * @param index Index at which the value is located.
+         * @returns The value at the given index.
+         * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+         */
+        std::uint64_t packed_array_t::at(std::size_t index) const
+        {
+            if (index >= size())
+            {
+                throw IndexError("Can not access value %zu of a packed array of size %zu.", index, size());
+            }
+            const std::size_t block = index / __PACKED_ARRAY_BLOCK;
+            if (block == __blocks.size())
+            {
+                return __tail[index % __PACKED_ARRAY_BLOCK];
+            }
+            const block_t &header = __blocks[block];
+            const std::size_t bit = (index % __PACKED_ARRAY_BLOCK) * header.width;
+            const std::uint64_t *words = __words.data() + header.offset + (bit >> 6);
+            const unsigned shift = static_cast<unsigned>(bit & 63);
+            const std::uint64_t mask = header.width >= 64 ? ~static_cast<std::uint64_t>(0) : (static_cast<std::uint64_t>(1) << header.width) - 1;
+            return header.base + (((words[0] >> shift) | ((words[1] << 1) << (63 - shift))) & mask);
+        }
+
+        /**
+         * @brief Decode a range of values. Whole blocks are unpacked directly into the output.
+         * @param index Index of the first value to decode.
+         * @param count Number of values to decode.
+         * @param output Pointer to at least `count` values, into which the values are written.
+         * @exception If the range extends past the size of the array, an `IndexError` is thrown.
+         */
+        void packed_array_t::decode(std::size_t index, std::size_t count, std::uint64_t *output) const
+        {
+            if (index > size() || count > size() - index)
+            {
+                throw IndexError("Can not decode %zu values at %zu of a packed array of size %zu.", count, index, size());
+            }
+            std::uint64_t buffer[__PACKED_ARRAY_BLOCK];
+            while (count > 0)
+            {
+                const std::size_t block = index / __PACKED_ARRAY_BLOCK;
+                const std::size_t within = index % __PACKED_ARRAY_BLOCK;
+                const std::size_t length = __PACKED_ARRAY_BLOCK - within < count ? __PACKED_ARRAY_BLOCK - within : count;
+                if (block == __blocks.size())
+                {
+                    std::memcpy(output, __tail.data() + within, length * sizeof(std::uint64_t));
+                }
+                else
+                {
+                    const block_t &header = __blocks[block];
+                    const bool whole = 0 == within && __PACKED_ARRAY_BLOCK == length;
+                    __packed_unpack(__words.data() + header.offset, whole ? length : within + length, header.base, header.width, whole ? output : buffer);
+                    if (!whole)
+                    {
+                        std::memcpy(output, buffer + within, length * sizeof(std::uint64_t));
+                    }
+                }
+                index += length;
+                output += length;
+                count -= length;
+            }
+        }
+
+        /**
+         * @brief Obtain the number of values within the array.
+         * @returns The size of the array.
+         */
+        std::size_t packed_array_t::size(void) const noexcept
+        {
+            return __blocks.size() * __PACKED_ARRAY_BLOCK + __tail.size();
+        }
+
+        /**
+         * @brief Determine if the array is empty.
+         * @returns True if the array is determined to be empty, else false.
+         */
+        bool packed_array_t::is_empty(void) const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Determine if the array is full. A packed array is never full.
+         * @returns False.
+         */
+        bool packed_array_t::is_full(void) const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Estimate the memory used by the values of the array.
+         * @returns The number of bytes used by the packed words, the block headers, and the unpacked tail.
+         */
+        std::size_t packed_array_t::size_in_bytes(void) const noexcept
+        {
+            return __words.size() * sizeof(std::uint64_t) + __blocks.size() * sizeof(block_t) + __tail.size() * sizeof(std::uint64_t);
+        }
+
+        /**
+         * @brief Pack the unpacked tail into a new block.
+         */
+        void packed_array_t::_seal(void)
+        {
+            std::uint64_t minimum = __tail[0];
+            std::uint64_t maximum = __tail[0];
+            for (std::size_t i = 1; i < __tail.size(); ++i)
+            {
+                minimum = __tail[i] < minimum ? __tail[i] : minimum;
+                maximum = __tail[i] > maximum ? __tail[i] : maximum;
+            }
+            const std::uint8_t width = __packed_width(maximum - minimum);
+            const std::size_t offset = __words.size();
+            __words.resize(offset + __packed_words(__tail.size(), width), 0);
+            __packed_pack(__tail.data(), __tail.size(), minimum, width, __words.data() + offset);
+            __blocks.push_back(block_t{minimum, offset, width});
+            __tail.clear();
+        }
+
+        /**
+         * @brief Construct a new empty array.
+         */
+        delta_array_t::delta_array_t(void) noexcept : __bytes(), __blocks(), __last(0), __size(0) {}
+
+        /**
+         * @brief Append a value to the array.
+         * @param value Value to append. The value must not be less than the last value within the array.
+         * @exception If the value is less than the last value within the array, a `ValueError` is thrown.
+         */
+        void delta_array_t::append(std::uint64_t value)
+        {
+            if (__size > 0 && value < __last)
+            {
+                throw ValueError("Can not append a value less than the last value of a delta array.");
+            }
+            if (__size % __PACKED_ARRAY_BLOCK == 0)
+            {
+                __blocks.push_back(block_t{value, __bytes.size()});
+            }
+            else
+            {
+                __varint_encode(__bytes, value - __last);
+            }
+            __last = value;
+            __size++;
+        }
+
+        /**
+         * @brief Obtain the value at a given index. The block holding the value is decoded up to the index.
+         * @param index Index at which the value is located.
+         * @returns The value at the given index.
+         * @exception If the given index is greater than or equal to the size of the array, an `IndexError` is thrown.
+         */
+        std::uint64_t delta_array_t::at(std::size_t index) const
+        {
+            if (index >= __size)
+            {
+                throw IndexError("Can not access value %zu of a delta array of size %zu.", index, __size);
+            }
+            const block_t &header = __blocks[index / __PACKED_ARRAY_BLOCK];
+            const std::uint8_t *bytes = __bytes.data() + header.offset;
+            std::uint64_t value = header.first;
+            for (std::size_t i = index % __PACKED_ARRAY_BLOCK; i > 0; --i)
+            {
+                value += __varint_decode(bytes);
+            }
+            return value;
+        }
+
+        /**
+         * @brief Decode a range of values.
+         * @param index Index of the first value to decode.
+         * @param count Number of values to decode.
+         * @param output Pointer to at least `count` values, into which the values are written.
+         * @exception If the range extends past the size of the array, an `IndexError` is thrown.
+         */
+        void delta_array_t::decode(std::size_t index, std::size_t count, std::uint64_t *output) const
+        {
+            if (index > __size || count > __size - index)
+            {
+                throw IndexError("Can not decode %zu values at %zu of a delta array of size %zu.", count, index, __size);
+            }
+            while (count > 0)
+            {
+                const block_t &header = __blocks[index / __PACKED_ARRAY_BLOCK];
+                const std::uint8_t *bytes = __bytes.data() + header.offset;
+                std::uint64_t value = header.first;
+                std::size_t position = index - index % __PACKED_ARRAY_BLOCK;
+                for (; position < index; ++position)
+                {
+                    value += __varint_decode(bytes);
+                }
+                // Every value of the block from the index onwards is emitted while it is decoded.
+                const std::size_t end = position + __PACKED_ARRAY_BLOCK - index % __PACKED_ARRAY_BLOCK;
+                for (; position < end && count > 0; ++position, --count)
+                {
+                    if (position != index)
+                    {
+                        value += __varint_decode(bytes);
+                    }
+                    *output++ = value;
+                }
+                index = position;
+            }
+        }
+
+        /**
+         * @brief Obtain the number of values within the array.
+         * @returns The size of the array.
+         */
+        std::size_t delta_array_t::size(void) const noexcept
+        {
+            return __size;
+        }
+
+        /**
+         * @brief Determine if the array is empty.
+         * @returns True if the array is determined to be empty, else false.
+         */
+        bool delta_array_t::is_empty(void) const noexcept
+        {
+            return __size == 0;
+        }
+
+        /**
+         * @brief Determine if the array is full. A delta array is never full.
+         * @returns False.
+         */
+        bool delta_array_t::is_full(void) const noexcept
+        {
+            return false;
+        }
+
+        /**
+         * @brief Estimate the memory used by the values of the array.
+         * @returns The number of bytes used by the encoded differences and the block headers.
+         */
+        std::size_t delta_array_t::size_in_bytes(void) const noexcept
+        {
+            return __bytes.size() + __blocks.size() * sizeof(block_t);
+        }
+    }
+}
+
+#endif // PACKED_ARRAY_IMPLEMENTATION
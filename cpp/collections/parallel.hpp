@@ -0,0 +1,580 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <atomic> // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstddef> // std::size_t
+#include <exception> // std::exception_ptr
+#include <functional> // std::less
+#include <mutex> // std::mutex
+#include <thread> // std::thread
+#include <utility> // std::declval
+#include <vector> // std::vector
+
+#include "array_view.hpp" // array_view_t
+
+#ifndef PARALLEL_GRAIN_SIZE
+#define PARALLEL_GRAIN_SIZE 4096
+#endif // PARALLEL_GRAIN_SIZE
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Fixed set of worker threads executing batches of tasks. The calling thread takes part in every batch, and tasks are claimed one at a time from a shared counter, so faster threads take on more of them.
+         */
+        struct thread_pool_t
+        {
+            public:
+                /**
+                 * @brief Construct a new pool with one thread per hardware thread, including the calling thread.
+                 */
+                thread_pool_t(void);
+
+                /**
+                 * @brief Construct a new pool with a given number of threads, including the calling thread.
+                 * @param threads Number of threads executing each batch.
+                 * @exception If the given number of threads is zero, a `ValueError` is thrown.
+                 */
+                explicit thread_pool_t(std::size_t threads);
+
+                thread_pool_t(const thread_pool_t &) = delete;
+                thread_pool_t &operator=(const thread_pool_t &) = delete;
+
+                /**
+                 * @brief Call a given function once for every task within a batch, and wait for every call to return. Only one batch runs at a time; concurrent callers wait for their turn. A task must not run another batch on the same pool.
+                 * @param tasks Number of tasks within the batch.
+                 * @param function Callable taking the index of a task.
+                 * @exception If any task throws, the remaining tasks are skipped and the first exception is rethrown.
+                 */
+                template <typename Function>
+                void run(std::size_t tasks, Function function);
+
+                /**
+                 * @brief Obtain the number of threads executing each batch, including the calling thread.
+                 * @returns The size of the pool.
+                 */
+                std::size_t size(void) const noexcept;
+
+                /**
+                 * @brief Obtain the pool shared by every parallel algorithm that is not given one. It is constructed on first use with one thread per hardware thread.
+                 * @returns A reference to the shared pool.
+                 */
+                static thread_pool_t &global(void);
+
+                /**
+                 * @brief Stop and join every worker thread.
+                 */
+                ~thread_pool_t();
+
+            protected:
+                /**
+                 * @brief Run a batch of tasks through a type-erased function.
+                 * @param tasks Number of tasks within the batch.
+                 * @param invoke Function calling the callable at a given context with the index of a task.
+                 * @param context Pointer to the callable.
+                 */
+                void _run(std::size_t tasks, void (*invoke)(void *, std::size_t), void *context);
+
+                /**
+                 * @brief Claim and execute tasks of the current batch until none remain.
+                 */
+                void _work(void);
+
+                /**
+                 * @brief Body of every worker thread.
+                 */
+                void _worker(void);
+
+            protected:
+                std::vector<std::thread> __workers;
+                std::mutex __batch;
+                std::mutex __mutex;
+                std::condition_variable __wake;
+                std::condition_variable __done;
+                std::size_t __generation;
+                std::size_t __active;
+                bool __stopping;
+                std::size_t __tasks;
+                void (*__invoke)(void *, std::size_t);
+                void *__context;
+                std::atomic<std::size_t> __next;
+                std::exception_ptr __error;
+        };
+
+        template <typename Type>
+        array_view_t<Type> __parallel_view(array_view_t<Type> view) noexcept;
+
+        template <typename Type>
+        array_view_t<Type> __parallel_view(array_t<Type> &array) noexcept;
+
+        template <typename Type>
+        array_view_t<const Type> __parallel_view(const array_t<Type> &array) noexcept;
+
+        /**
+         * @brief Call a given function for every item of a range, split into chunks across a pool.
+         * @param range Array, dynamic array, or view of the items.
+         * @param function Callable taking an item; it may modify the item.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Function>
+        void parallel_for(Range &&range, Function function, std::size_t grain = PARALLEL_GRAIN_SIZE, thread_pool_t &pool = thread_pool_t::global());
+
+        /**
+         * @brief Write the result of a given function for every item of a range into the item at the same index within another range.
+         * @param input Array, dynamic array, or view of the items.
+         * @param output Array, dynamic array, or view into which to write the results.
+         * @param function Callable taking an item and returning its result.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the output is smaller than the input or the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Input, typename Output, typename Function>
+        void parallel_transform(Input &&input, Output &&output, Function function, std::size_t grain = PARALLEL_GRAIN_SIZE, thread_pool_t &pool = thread_pool_t::global());
+
+        /**
+         * @brief Combine every item of a range into a single value. Each chunk is reduced from the identity, then the results of the chunks are combined in order, so the result depends on the grain but never on the number of threads.
+         * @param range Array, dynamic array, or view of the items.
+         * @param identity Value from which every chunk is reduced, such as zero for a sum.
+         * @param reduce Callable taking the current value of a chunk and an item, and returning the next value.
+         * @param combine Callable taking two values and returning their combination.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @returns The combined value, which is the identity if the range is empty.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Value, typename Reduce, typename Combine>
+        Value parallel_reduce(Range &&range, Value identity, Reduce reduce, Combine combine, std::size_t grain = PARALLEL_GRAIN_SIZE, thread_pool_t &pool = thread_pool_t::global());
+
+        /**
+         * @brief Sort the items of a range. Each chunk is sorted, then adjacent runs are merged in parallel passes. The sort is stable.
+         * @param range Array, dynamic array, or view of the items.
+         * @param compare Callable taking two items and returning true if the first is ordered before the second.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Compare = std::less<>>
+        void parallel_sort(Range &&range, Compare compare = Compare(), std::size_t grain = PARALLEL_GRAIN_SIZE, thread_pool_t &pool = thread_pool_t::global());
+
+        /**
+         * @brief Search for the first item of a range satisfying a given predicate. Chunks after a match already found are skipped.
+         * @param range Array, dynamic array, or view of the items.
+         * @param predicate Callable taking an item and returning true if it matches.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @returns A pointer to the first matching item, or `nullptr` if no item matches.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Predicate>
+        auto parallel_find(Range &&range, Predicate predicate, std::size_t grain = PARALLEL_GRAIN_SIZE, thread_pool_t &pool = thread_pool_t::global()) -> decltype(__parallel_view(range).data());
+    }
+}
+
+#endif // PARALLEL_HPP
+
+#if defined(PARALLEL_IMPLEMENTATION) && !defined(PARALLEL_IMPLEMENTED)
+#define PARALLEL_IMPLEMENTED
+
+#include <algorithm> // std::stable_sort, std::merge, std::move
+#include <iterator> // std::make_move_iterator
+#include <type_traits> // std::remove_cv
+
+#define ARRAY_VIEW_IMPLEMENTATION
+#include "array_view.hpp"
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new pool with one thread per hardware thread, including the calling thread.
+         */
+        inline thread_pool_t::thread_pool_t(void) : thread_pool_t(std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1) {}
+
+        /**
+         * @brief Construct a new pool with a given number of threads, including the calling thread.
+         * @param threads Number of threads executing each batch.
+         * @exception If the given number of threads is zero, a `ValueError` is thrown.
+         */
+        inline thread_pool_t::thread_pool_t(std::size_t threads) : __generation(0), __active(0), __stopping(false), __tasks(0), __invoke(nullptr), __context(nullptr), __next(0)
+        {
+            if (threads == 0)
+            {
+                throw ValueError("Can not construct a thread pool without threads.");
+            }
+            __workers.reserve(threads - 1);
+            for (std::size_t index = 1; index < threads; index++)
+            {
+                __workers.emplace_back(&thread_pool_t::_worker, this);
+            }
+        }
+
+        /**
+         * @brief Call a given function once for every task within a batch, and wait for every call to return. Only one batch runs at a time; concurrent callers wait for their turn. A task must not run another batch on the same pool.
+         * @param tasks Number of tasks within the batch.
+         * @param function Callable taking the index of a task.
+         * @exception If any task throws, the remaining tasks are skipped and the first exception is rethrown.
+         */
+        template <typename Function>
+        void thread_pool_t::run(std::size_t tasks, Function function)
+        {
+            _run(tasks, [](void *context, std::size_t task) { (*static_cast<Function *>(context))(task); }, &function);
+        }
+
+        /**
+         * @brief Obtain the number of threads executing each batch, including the calling thread.
+         * @returns The size of the pool.
+         */
+        inline std::size_t thread_pool_t::size(void) const noexcept
+        {
+            return __workers.size() + 1;
+        }
+
+        /**
+         * @brief Obtain the pool shared by every parallel algorithm that is not given one. It is constructed on first use with one thread per hardware thread.
+         * @returns A reference to the shared pool.
+         */
+        inline thread_pool_t &thread_pool_t::global(void)
+        {
+            static thread_pool_t pool;
+            return pool;
+        }
+
+        /**
+         * @brief Stop and join every worker thread.
+         */
+        inline thread_pool_t::~thread_pool_t()
+        {
+            {
+                std::lock_guard<std::mutex> lock(__mutex);
+                __stopping = true;
+            }
+            __wake.notify_all();
+            for (std::thread &worker : __workers)
+            {
+                worker.join();
+            }
+        }
+
+        /**
+         * @brief Run a batch of tasks through a type-erased function.
+         * @param tasks Number of tasks within the batch.
+         * @param invoke Function calling the callable at a given context with the index of a task.
+         * @param context Pointer to the callable.
+         */
+        inline void thread_pool_t::_run(std::size_t tasks, void (*invoke)(void *, std::size_t), void *context)
+        {
+            if (tasks == 0)
+            {
+                return;
+            }
+            if (__workers.empty() || tasks == 1)
+            {
+                for (std::size_t task = 0; task < tasks; task++)
+                {
+                    invoke(context, task);
+                }
+                return;
+            }
+            std::lock_guard<std::mutex> batch(__batch);
+            {
+                std::unique_lock<std::mutex> lock(__mutex);
+                // A worker that woke too late for the previous batch may still be leaving it; the batch must not change under it.
+                __done.wait(lock, [this] { return __active == 0; });
+                __tasks = tasks;
+                __invoke = invoke;
+                __context = context;
+                __error = nullptr;
+                __next.store(0, std::memory_order_relaxed);
+                __generation++;
+            }
+            __wake.notify_all();
+            _work();
+            std::exception_ptr error;
+            {
+                std::unique_lock<std::mutex> lock(__mutex);
+                // Every task has been claimed once the calling thread returns from `_work`, so the batch is over once no worker is executing one.
+                __done.wait(lock, [this] { return __active == 0; });
+                error = __error;
+                __error = nullptr;
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief Claim and execute tasks of the current batch until none remain.
+         */
+        inline void thread_pool_t::_work(void)
+        {
+            for (std::size_t task = __next.fetch_add(1, std::memory_order_relaxed); task < __tasks; task = __next.fetch_add(1, std::memory_order_relaxed))
+            {
+                try
+                {
+                    __invoke(__context, task);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(__mutex);
+                    if (!__error)
+                    {
+                        __error = std::current_exception();
+                    }
+                    // Skip every task that has not been claimed yet.
+                    __next.store(__tasks, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Body of every worker thread.
+         */
+        inline void thread_pool_t::_worker(void)
+        {
+            std::unique_lock<std::mutex> lock(__mutex);
+            std::size_t generation = __generation;
+            for (;;)
+            {
+                __wake.wait(lock, [&] { return __stopping || __generation != generation; });
+                if (__stopping)
+                {
+                    return;
+                }
+                generation = __generation;
+                __active++;
+                lock.unlock();
+                _work();
+                lock.lock();
+                if (--__active == 0)
+                {
+                    __done.notify_all();
+                }
+            }
+        }
+
+        template <typename Type>
+        array_view_t<Type> __parallel_view(array_view_t<Type> view) noexcept
+        {
+            return view;
+        }
+
+        template <typename Type>
+        array_view_t<Type> __parallel_view(array_t<Type> &array) noexcept
+        {
+            return array_view_t<Type>(array);
+        }
+
+        template <typename Type>
+        array_view_t<const Type> __parallel_view(const array_t<Type> &array) noexcept
+        {
+            return array_view_t<const Type>(array);
+        }
+
+        namespace
+        {
+            /**
+             * @brief Determine the number of chunks of a given grain needed to cover a given number of items.
+             * @param size Number of items.
+             * @param grain Number of items within each chunk.
+             * @returns The number of chunks.
+             * @exception If the grain is zero, a `ValueError` is thrown.
+             */
+            inline std::size_t __parallel_chunks(std::size_t size, std::size_t grain)
+            {
+                if (grain == 0)
+                {
+                    throw ValueError("Can not split a range into chunks of zero items.");
+                }
+                return (size + grain - 1) / grain;
+            }
+
+            /**
+             * @brief Obtain the chunk at a given index of a view.
+             * @param view View to split.
+             * @param chunk Index of the chunk.
+             * @param grain Number of items within each chunk.
+             * @returns The chunk, which is shorter than the grain only if it is the last.
+             */
+            template <typename Type>
+            array_view_t<Type> __parallel_chunk(array_view_t<Type> view, std::size_t chunk, std::size_t grain) noexcept
+            {
+                const std::size_t offset = chunk * grain;
+                return array_view_t<Type>(view.data() + offset, view.size() - offset < grain ? view.size() - offset : grain);
+            }
+        }
+
+        /**
+         * @brief Call a given function for every item of a range, split into chunks across a pool.
+         * @param range Array, dynamic array, or view of the items.
+         * @param function Callable taking an item; it may modify the item.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Function>
+        void parallel_for(Range &&range, Function function, std::size_t grain, thread_pool_t &pool)
+        {
+            const auto view = __parallel_view(range);
+            pool.run(__parallel_chunks(view.size(), grain), [&](std::size_t chunk) {
+                for (auto &item : __parallel_chunk(view, chunk, grain))
+                {
+                    function(item);
+                }
+            });
+        }
+
+        /**
+         * @brief Write the result of a given function for every item of a range into the item at the same index within another range.
+         * @param input Array, dynamic array, or view of the items.
+         * @param output Array, dynamic array, or view into which to write the results.
+         * @param function Callable taking an item and returning its result.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the output is smaller than the input or the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Input, typename Output, typename Function>
+        void parallel_transform(Input &&input, Output &&output, Function function, std::size_t grain, thread_pool_t &pool)
+        {
+            const auto source = __parallel_view(input);
+            const auto destination = __parallel_view(output);
+            if (destination.size() < source.size())
+            {
+                throw ValueError("Can not transform %zu items into a range of size %zu.", source.size(), destination.size());
+            }
+            pool.run(__parallel_chunks(source.size(), grain), [&](std::size_t chunk) {
+                const std::size_t offset = chunk * grain;
+                const auto items = __parallel_chunk(source, chunk, grain);
+                for (std::size_t index = 0; index < items.size(); index++)
+                {
+                    destination[offset + index] = function(items[index]);
+                }
+            });
+        }
+
+        /**
+         * @brief Combine every item of a range into a single value. Each chunk is reduced from the identity, then the results of the chunks are combined in order, so the result depends on the grain but never on the number of threads.
+         * @param range Array, dynamic array, or view of the items.
+         * @param identity Value from which every chunk is reduced, such as zero for a sum.
+         * @param reduce Callable taking the current value of a chunk and an item, and returning the next value.
+         * @param combine Callable taking two values and returning their combination.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @returns The combined value, which is the identity if the range is empty.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Value, typename Reduce, typename Combine>
+        Value parallel_reduce(Range &&range, Value identity, Reduce reduce, Combine combine, std::size_t grain, thread_pool_t &pool)
+        {
+            const auto view = __parallel_view(range);
+            const std::size_t chunks = __parallel_chunks(view.size(), grain);
+            std::vector<Value> partials(chunks, identity);
+            pool.run(chunks, [&](std::size_t chunk) {
+                Value value = identity;
+                for (auto &item : __parallel_chunk(view, chunk, grain))
+                {
+                    value = reduce(std::move(value), item);
+                }
+                partials[chunk] = std::move(value);
+            });
+            Value result = std::move(identity);
+            for (Value &partial : partials)
+            {
+                result = combine(std::move(result), std::move(partial));
+            }
+            return result;
+        }
+
+        /**
+         * @brief Sort the items of a range. Each chunk is sorted, then adjacent runs are merged in parallel passes. The sort is stable.
+         * @param range Array, dynamic array, or view of the items.
+         * @param compare Callable taking two items and returning true if the first is ordered before the second.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Compare>
+        void parallel_sort(Range &&range, Compare compare, std::size_t grain, thread_pool_t &pool)
+        {
+            const auto view = __parallel_view(range);
+            using value_t = typename std::remove_cv<typename std::remove_pointer<decltype(view.data())>::type>::type;
+            const std::size_t size = view.size();
+            pool.run(__parallel_chunks(size, grain), [&](std::size_t chunk) {
+                const auto items = __parallel_chunk(view, chunk, grain);
+                std::stable_sort(items.begin(), items.end(), compare);
+            });
+            if (size <= grain)
+            {
+                return;
+            }
+            // Runs are merged back and forth between the range and a buffer, doubling their width on every pass.
+            std::vector<value_t> buffer(size);
+            value_t *source = view.data();
+            value_t *destination = buffer.data();
+            for (std::size_t width = grain; width < size; width *= 2)
+            {
+                pool.run(__parallel_chunks(size, width * 2), [&](std::size_t pair) {
+                    const std::size_t first = pair * width * 2;
+                    const std::size_t middle = size - first < width ? size : first + width;
+                    const std::size_t last = size - middle < width ? size : middle + width;
+                    std::merge(std::make_move_iterator(source + first), std::make_move_iterator(source + middle), std::make_move_iterator(source + middle), std::make_move_iterator(source + last), destination + first, compare);
+                });
+                std::swap(source, destination);
+            }
+            if (source != view.data())
+            {
+                pool.run(__parallel_chunks(size, grain), [&](std::size_t chunk) {
+                    const std::size_t first = chunk * grain;
+                    const std::size_t last = size - first < grain ? size : first + grain;
+                    std::move(source + first, source + last, view.data() + first);
+                });
+            }
+        }
+
+        /**
+         * @brief Search for the first item of a range satisfying a given predicate. Chunks after a match already found are skipped.
+         * @param range Array, dynamic array, or view of the items.
+         * @param predicate Callable taking an item and returning true if it matches.
+         * @param grain Number of items within each chunk.
+         * @param pool Pool executing the chunks.
+         * @returns A pointer to the first matching item, or `nullptr` if no item matches.
+         * @exception If the grain is zero, a `ValueError` is thrown.
+         */
+        template <typename Range, typename Predicate>
+        auto parallel_find(Range &&range, Predicate predicate, std::size_t grain, thread_pool_t &pool) -> decltype(__parallel_view(range).data())
+        {
+            const auto view = __parallel_view(range);
+            std::atomic<std::size_t> found(view.size());
+            pool.run(__parallel_chunks(view.size(), grain), [&](std::size_t chunk) {
+                const std::size_t offset = chunk * grain;
+                // Chunks are claimed in order, so a match before this chunk makes the rest of the range irrelevant.
+                if (offset >= found.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                const auto items = __parallel_chunk(view, chunk, grain);
+                for (std::size_t index = 0; index < items.size(); index++)
+                {
+                    if (predicate(items[index]))
+                    {
+                        std::size_t current = found.load(std::memory_order_relaxed);
+                        while (offset + index < current && !found.compare_exchange_weak(current, offset + index, std::memory_order_relaxed)) {}
+                        return;
+                    }
+                }
+            });
+            const std::size_t index = found.load(std::memory_order_relaxed);
+            return index < view.size() ? view.data() + index : nullptr;
+        }
+    }
+}
+
+#endif // PARALLEL_IMPLEMENTATION
@@ -0,0 +1,662 @@
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include <cstddef> // std::size_t
+#include <utility> // std::declval, std::pair
+
+#include "array_view.hpp" // array_view_t
+#include "collection.hpp" // collection_t
+#include "dynamic_array.hpp" // dynamic_array_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        template <typename Type>
+        struct __pipeline_view_t;
+
+        template <typename Type>
+        struct __pipeline_collection_t;
+
+        template <typename Source, typename Function>
+        struct __pipeline_map_t;
+
+        template <typename Source, typename Function>
+        struct __pipeline_filter_t;
+
+        template <typename Source>
+        struct __pipeline_take_t;
+
+        template <typename Source>
+        struct __pipeline_chunk_t;
+
+        template <typename Source>
+        struct __pipeline_enumerate_t;
+
+        template <typename Source, typename Other>
+        struct __pipeline_zip_t;
+
+        template <typename Type>
+        __pipeline_view_t<Type> __pipeline_source(array_view_t<Type> view) noexcept;
+
+        template <typename Type>
+        __pipeline_view_t<Type> __pipeline_source(array_t<Type> &array) noexcept;
+
+        template <typename Type>
+        __pipeline_view_t<const Type> __pipeline_source(const array_t<Type> &array) noexcept;
+
+        template <typename Type>
+        __pipeline_collection_t<Type> __pipeline_source(const collection_t<Type> &collection) noexcept;
+
+        /**
+         * @brief Lazy sequence of items. Adaptors such as `map` and `filter` only describe a step; nothing is evaluated until a terminal operation such as `reduce` pushes every item through every step. Each step is a distinct type, so the compiler inlines the whole chain into a single loop and no intermediate collection is materialised.
+         */
+        template <typename Source>
+        struct pipeline_t
+        {
+            public:
+                /**
+                 * @brief Type of the items pushed through the pipeline. Items of an array or view are pushed by reference.
+                 */
+                using item_t = typename Source::item_t;
+
+                /**
+                 * @brief Construct a new pipeline over a given source. Use the `pipeline` function instead.
+                 * @param source Source of the items.
+                 */
+                explicit pipeline_t(Source source);
+
+                /**
+                 * @brief Transform every item with a given function.
+                 * @param function Callable taking an item and returning its replacement.
+                 * @returns A new pipeline of the transformed items.
+                 */
+                template <typename Function>
+                pipeline_t<__pipeline_map_t<Source, Function>> map(Function function) const;
+
+                /**
+                 * @brief Keep only the items satisfying a given predicate.
+                 * @param function Callable taking an item and returning true if the item is kept.
+                 * @returns A new pipeline of the kept items.
+                 */
+                template <typename Function>
+                pipeline_t<__pipeline_filter_t<Source, Function>> filter(Function function) const;
+
+                /**
+                 * @brief Keep at most a given number of items. The source stops as soon as they have been pushed.
+                 * @param count Maximum number of items.
+                 * @returns A new pipeline of the first items.
+                 */
+                pipeline_t<__pipeline_take_t<Source>> take(std::size_t count) const;
+
+                /**
+                 * @brief Group consecutive items into views of a given size; the last view may be shorter. Over an array or view, each chunk is a subview and nothing is copied; otherwise the items are buffered.
+                 * @param size Number of items within each chunk.
+                 * @returns A new pipeline of chunks.
+                 * @exception If the given size is zero, a `ValueError` is thrown.
+                 */
+                pipeline_t<__pipeline_chunk_t<Source>> chunk(std::size_t size) const;
+
+                /**
+                 * @brief Pair every item with its index, starting at zero.
+                 * @returns A new pipeline of `std::pair` holding the index and the item.
+                 */
+                pipeline_t<__pipeline_enumerate_t<Source>> enumerate(void) const;
+
+                /**
+                 * @brief Pair every item with the item at the same index within another collection, stopping at the end of the shorter of the two. The other collection is only read, by index, so it must be an array, a view, or a collection.
+                 * @param other Collection with which to pair the items.
+                 * @returns A new pipeline of `std::pair` holding both items.
+                 */
+                template <typename Other>
+                pipeline_t<__pipeline_zip_t<Source, decltype(__pipeline_source(std::declval<const Other &>()))>> zip(const Other &other) const;
+
+                /**
+                 * @brief Call a given function for every item.
+                 * @param function Callable taking an item.
+                 */
+                template <typename Function>
+                void for_each(Function function);
+
+                /**
+                 * @brief Append every item to a given dynamic array.
+                 * @param array Dynamic array to which the items are appended.
+                 * @exception If the array can not be reallocated, an `AllocationError` is thrown.
+                 */
+                template <typename Type>
+                void collect_into(dynamic_array_t<Type> &array);
+
+                /**
+                 * @brief Combine every item into a single value, from the first item to the last.
+                 * @param initial Value with which to start.
+                 * @param function Callable taking the current value and an item, and returning the next value.
+                 * @returns The final value.
+                 */
+                template <typename Value, typename Function>
+                Value reduce(Value initial, Function function);
+
+                /**
+                 * @brief Obtain the number of items within the pipeline. Every item is evaluated.
+                 * @returns The number of items.
+                 */
+                std::size_t count(void);
+
+            protected:
+                Source __source;
+        };
+
+        /**
+         * @brief Construct a new pipeline over the items of a view.
+         * @param view View of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<Type>> pipeline(array_view_t<Type> view) noexcept;
+
+        /**
+         * @brief Construct a new pipeline over the items of an array, including a dynamic array. The items are read directly from its storage.
+         * @param array Array of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<Type>> pipeline(array_t<Type> &array) noexcept;
+
+        /**
+         * @brief Construct a new pipeline over the items of a constant array, including a dynamic array.
+         * @param array Array of the items.
+         * @returns A new pipeline pushing every item by constant reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<const Type>> pipeline(const array_t<Type> &array) noexcept;
+
+        /**
+         * @brief Construct a new pipeline over the items of any other collection. Every item is obtained through `at`.
+         * @param collection Collection of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_collection_t<Type>> pipeline(const collection_t<Type> &collection) noexcept;
+    }
+}
+
+#endif // PIPELINE_HPP
+
+#if defined(PIPELINE_IMPLEMENTATION) && !defined(PIPELINE_IMPLEMENTED)
+#define PIPELINE_IMPLEMENTED
+
+#include <type_traits> // std::decay
+#include <utility> // std::forward, std::move
+#include <vector> // std::vector
+
+#define ARRAY_VIEW_IMPLEMENTATION
+#include "array_view.hpp"
+
+#define DYNAMIC_ARRAY_IMPLEMENTATION
+#include "dynamic_array.hpp"
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace polutils
+{
+    namespace collections
+    {
+        // Every step exposes `each`, which pushes its items into a sink until the sink returns false, and returns false if it was stopped.
+
+        /**
+         * @brief Source of the items of a contiguous range.
+         */
+        template <typename Type>
+        struct __pipeline_view_t
+        {
+            using item_t = Type &;
+
+            array_view_t<Type> view;
+
+            std::size_t size(void) const noexcept
+            {
+                return view.size();
+            }
+
+            Type &get(std::size_t index) const noexcept
+            {
+                return view[index];
+            }
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                for (Type &item : view)
+                {
+                    if (!sink(item))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief Source of the items of a collection, obtained one at a time through `at`.
+         */
+        template <typename Type>
+        struct __pipeline_collection_t
+        {
+            using item_t = Type &;
+
+            const collection_t<Type> *collection;
+
+            std::size_t size(void) const noexcept
+            {
+                return collection->size();
+            }
+
+            Type &get(std::size_t index) const
+            {
+                return *collection->at(index);
+            }
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                const std::size_t size = collection->size();
+                for (std::size_t index = 0; index < size; index++)
+                {
+                    if (!sink(*collection->at(index)))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief Step transforming every item.
+         */
+        template <typename Source, typename Function>
+        struct __pipeline_map_t
+        {
+            using item_t = decltype(std::declval<Function &>()(std::declval<typename Source::item_t>()));
+
+            Source source;
+            Function function;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                return source.each([&](auto &&item) { return sink(function(std::forward<decltype(item)>(item))); });
+            }
+        };
+
+        /**
+         * @brief Step keeping the items satisfying a predicate.
+         */
+        template <typename Source, typename Function>
+        struct __pipeline_filter_t
+        {
+            using item_t = typename Source::item_t;
+
+            Source source;
+            Function function;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                return source.each([&](auto &&item) { return !function(item) || sink(std::forward<decltype(item)>(item)); });
+            }
+        };
+
+        /**
+         * @brief Step keeping at most a given number of items.
+         */
+        template <typename Source>
+        struct __pipeline_take_t
+        {
+            using item_t = typename Source::item_t;
+
+            Source source;
+            std::size_t count;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                if (count == 0)
+                {
+                    return true;
+                }
+                std::size_t taken = 0;
+                bool stopped = false;
+                source.each([&](auto &&item) {
+                    stopped = !sink(std::forward<decltype(item)>(item));
+                    return !stopped && ++taken < count;
+                });
+                return !stopped;
+            }
+        };
+
+        /**
+         * @brief Step grouping the items into buffered chunks.
+         */
+        template <typename Source>
+        struct __pipeline_chunk_t
+        {
+            using value_t = typename std::decay<typename Source::item_t>::type;
+            using item_t = array_view_t<const value_t>;
+
+            Source source;
+            std::size_t size;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                // The buffer is reused for every chunk, so it is allocated once.
+                std::vector<value_t> buffer;
+                buffer.reserve(size);
+                bool stopped = false;
+                source.each([&](auto &&item) {
+                    buffer.push_back(std::forward<decltype(item)>(item));
+                    if (buffer.size() < size)
+                    {
+                        return true;
+                    }
+                    stopped = !sink(item_t(buffer.data(), buffer.size()));
+                    buffer.clear();
+                    return !stopped;
+                });
+                if (stopped)
+                {
+                    return false;
+                }
+                return buffer.empty() || sink(item_t(buffer.data(), buffer.size()));
+            }
+        };
+
+        /**
+         * @brief Step grouping the items of a contiguous range into subviews, without copying them.
+         */
+        template <typename Type>
+        struct __pipeline_chunk_t<__pipeline_view_t<Type>>
+        {
+            using item_t = array_view_t<Type>;
+
+            __pipeline_view_t<Type> source;
+            std::size_t size;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                const std::size_t total = source.view.size();
+                for (std::size_t offset = 0; offset < total; offset += size)
+                {
+                    const std::size_t count = total - offset < size ? total - offset : size;
+                    if (!sink(item_t(source.view.data() + offset, count)))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
+        /**
+         * @brief Step pairing every item with its index.
+         */
+        template <typename Source>
+        struct __pipeline_enumerate_t
+        {
+            using item_t = std::pair<std::size_t, typename Source::item_t>;
+
+            Source source;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                std::size_t index = 0;
+                return source.each([&](auto &&item) { return sink(item_t(index++, std::forward<decltype(item)>(item))); });
+            }
+        };
+
+        /**
+         * @brief Step pairing every item with the item at the same index within another collection.
+         */
+        template <typename Source, typename Other>
+        struct __pipeline_zip_t
+        {
+            using item_t = std::pair<typename Source::item_t, typename Other::item_t>;
+
+            Source source;
+            Other other;
+
+            template <typename Sink>
+            bool each(Sink &&sink)
+            {
+                const std::size_t size = other.size();
+                if (size == 0)
+                {
+                    return true;
+                }
+                std::size_t index = 0;
+                bool stopped = false;
+                source.each([&](auto &&item) {
+                    stopped = !sink(item_t(std::forward<decltype(item)>(item), other.get(index)));
+                    return !stopped && ++index < size;
+                });
+                return !stopped;
+            }
+        };
+
+        template <typename Type>
+        __pipeline_view_t<Type> __pipeline_source(array_view_t<Type> view) noexcept
+        {
+            return __pipeline_view_t<Type>{view};
+        }
+
+        template <typename Type>
+        __pipeline_view_t<Type> __pipeline_source(array_t<Type> &array) noexcept
+        {
+            return __pipeline_view_t<Type>{array_view_t<Type>(array)};
+        }
+
+        template <typename Type>
+        __pipeline_view_t<const Type> __pipeline_source(const array_t<Type> &array) noexcept
+        {
+            return __pipeline_view_t<const Type>{array_view_t<const Type>(array)};
+        }
+
+        template <typename Type>
+        __pipeline_collection_t<Type> __pipeline_source(const collection_t<Type> &collection) noexcept
+        {
+            return __pipeline_collection_t<Type>{&collection};
+        }
+
+        /**
+         * @brief Construct a new pipeline over a given source. Use the `pipeline` function instead.
+         * @param source Source of the items.
+         */
+        template <typename Source>
+        pipeline_t<Source>::pipeline_t(Source source) : __source(std::move(source)) {}
+
+        /**
+         * @brief Transform every item with a given function.
+         * @param function Callable taking an item and returning its replacement.
+         * @returns A new pipeline of the transformed items.
+         */
+        template <typename Source>
+        template <typename Function>
+        pipeline_t<__pipeline_map_t<Source, Function>> pipeline_t<Source>::map(Function function) const
+        {
+            return pipeline_t<__pipeline_map_t<Source, Function>>(__pipeline_map_t<Source, Function>{__source, std::move(function)});
+        }
+
+        /**
+         * @brief Keep only the items satisfying a given predicate.
+         * @param function Callable taking an item and returning true if the item is kept.
+         * @returns A new pipeline of the kept items.
+         */
+        template <typename Source>
+        template <typename Function>
+        pipeline_t<__pipeline_filter_t<Source, Function>> pipeline_t<Source>::filter(Function function) const
+        {
+            return pipeline_t<__pipeline_filter_t<Source, Function>>(__pipeline_filter_t<Source, Function>{__source, std::move(function)});
+        }
+
+        /**
+         * @brief Keep at most a given number of items. The source stops as soon as they have been pushed.
+         * @param count Maximum number of items.
+         * @returns A new pipeline of the first items.
+         */
+        template <typename Source>
+        pipeline_t<__pipeline_take_t<Source>> pipeline_t<Source>::take(std::size_t count) const
+        {
+            return pipeline_t<__pipeline_take_t<Source>>(__pipeline_take_t<Source>{__source, count});
+        }
+
+        /**
+         * @brief Group consecutive items into views of a given size; the last view may be shorter. Over an array or view, each chunk is a subview and nothing is copied; otherwise the items are buffered.
+         * @param size Number of items within each chunk.
+         * @returns A new pipeline of chunks.
+         * @exception If the given size is zero, a `ValueError` is thrown.
+         */
+        template <typename Source>
+        pipeline_t<__pipeline_chunk_t<Source>> pipeline_t<Source>::chunk(std::size_t size) const
+        {
+            if (size == 0)
+            {
+                throw ValueError("Can not split a pipeline into chunks of zero items.");
+            }
+            return pipeline_t<__pipeline_chunk_t<Source>>(__pipeline_chunk_t<Source>{__source, size});
+        }
+
+        /**
+         * @brief Pair every item with its index, starting at zero.
+         * @returns A new pipeline of `std::pair` holding the index and the item.
+         */
+        template <typename Source>
+        pipeline_t<__pipeline_enumerate_t<Source>> pipeline_t<Source>::enumerate(void) const
+        {
+            return pipeline_t<__pipeline_enumerate_t<Source>>(__pipeline_enumerate_t<Source>{__source});
+        }
+
+        /**
+         * @brief Pair every item with the item at the same index within another collection, stopping at the end of the shorter of the two. The other collection is only read, by index, so it must be an array, a view, or a collection.
+         * @param other Collection with which to pair the items.
+         * @returns A new pipeline of `std::pair` holding both items.
+         */
+        template <typename Source>
+        template <typename Other>
+        pipeline_t<__pipeline_zip_t<Source, decltype(__pipeline_source(std::declval<const Other &>()))>> pipeline_t<Source>::zip(const Other &other) const
+        {
+            using zip_t = __pipeline_zip_t<Source, decltype(__pipeline_source(std::declval<const Other &>()))>;
+            return pipeline_t<zip_t>(zip_t{__source, __pipeline_source(other)});
+        }
+
+        /**
+         * @brief Call a given function for every item.
+         * @param function Callable taking an item.
+         */
+        template <typename Source>
+        template <typename Function>
+        void pipeline_t<Source>::for_each(Function function)
+        {
+            __source.each([&](auto &&item) {
+                function(std::forward<decltype(item)>(item));
+                return true;
+            });
+        }
+
+        /**
+         * @brief Append every item to a given dynamic array.
+         * @param array Dynamic array to which the items are appended.
+         * @exception If the array can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Source>
+        template <typename Type>
+        void pipeline_t<Source>::collect_into(dynamic_array_t<Type> &array)
+        {
+            __source.each([&](auto &&item) {
+                array.append(std::forward<decltype(item)>(item));
+                return true;
+            });
+        }
+
+        /**
+         * @brief Combine every item into a single value, from the first item to the last.
+         * @param initial Value with which to start.
+         * @param function Callable taking the current value and an item, and returning the next value.
+         * @returns The final value.
+         */
+        template <typename Source>
+        template <typename Value, typename Function>
+        Value pipeline_t<Source>::reduce(Value initial, Function function)
+        {
+            __source.each([&](auto &&item) {
+                initial = function(std::move(initial), std::forward<decltype(item)>(item));
+                return true;
+            });
+            return initial;
+        }
+
+        /**
+         * @brief Obtain the number of items within the pipeline. Every item is evaluated.
+         * @returns The number of items.
+         */
+        template <typename Source>
+        std::size_t pipeline_t<Source>::count(void)
+        {
+            std::size_t count = 0;
+            __source.each([&](auto &&) {
+                count++;
+                return true;
+            });
+            return count;
+        }
+
+        /**
+         * @brief Construct a new pipeline over the items of a view.
+         * @param view View of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<Type>> pipeline(array_view_t<Type> view) noexcept
+        {
+            return pipeline_t<__pipeline_view_t<Type>>(__pipeline_source(view));
+        }
+
+        /**
+         * @brief Construct a new pipeline over the items of an array, including a dynamic array. The items are read directly from its storage.
+         * @param array Array of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<Type>> pipeline(array_t<Type> &array) noexcept
+        {
+            return pipeline_t<__pipeline_view_t<Type>>(__pipeline_source(array));
+        }
+
+        /**
+         * @brief Construct a new pipeline over the items of a constant array, including a dynamic array.
+         * @param array Array of the items.
+         * @returns A new pipeline pushing every item by constant reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_view_t<const Type>> pipeline(const array_t<Type> &array) noexcept
+        {
+            return pipeline_t<__pipeline_view_t<const Type>>(__pipeline_source(array));
+        }
+
+        /**
+         * @brief Construct a new pipeline over the items of any other collection. Every item is obtained through `at`.
+         * @param collection Collection of the items.
+         * @returns A new pipeline pushing every item by reference.
+         */
+        template <typename Type>
+        pipeline_t<__pipeline_collection_t<Type>> pipeline(const collection_t<Type> &collection) noexcept
+        {
+            return pipeline_t<__pipeline_collection_t<Type>>(__pipeline_source(collection));
+        }
+    }
+}
+
+#endif // PIPELINE_IMPLEMENTATION
@@ -0,0 +1,518 @@
+#ifndef POOL_HPP
+#define POOL_HPP
+
+#include <atomic> // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <memory> // std::shared_ptr
+#include <mutex> // std::mutex
+
+#include "dynamic_array.hpp" // dynamic_array_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief State of a pool shared with the caches of every thread, so that a cache can return its slots to the pool, or learn that the pool no longer exists. The mutex guards the shared list of the pool.
+         */
+        struct pool_control_t
+        {
+            std::mutex mutex;
+            void *pool;
+            void (*reclaim)(void *pool, void *head, std::uint64_t epoch) noexcept;
+        };
+
+        /**
+         * @brief Free slots of a pool cached by a single thread. The free slots are linked through their own storage.
+         */
+        struct pool_cache_t
+        {
+            std::shared_ptr<pool_control_t> control;
+            std::uint64_t epoch;
+            void *head;
+            std::size_t count;
+
+            /**
+             * @brief Return every cached slot to the pool that owns them, unless it has since been destroyed or released, and empty the cache.
+             */
+            void flush(void) noexcept;
+
+            /**
+             * @brief Return every cached slot to its pool when the thread exits.
+             */
+            ~pool_cache_t();
+        };
+
+        /**
+         * @brief Allocator of fixed-size slots for a single type. Slots are carved out of large slabs, and free slots are linked through their own storage. Every thread keeps a private cache of free slots, so most allocations and deallocations take no lock; the caches trade slots with a shared list in batches.
+         */
+        template <typename Type>
+        struct pool_t
+        {
+            public:
+                /**
+                 * @brief Construct a new pool whose slabs hold a default number of slots.
+                 */
+                pool_t(void);
+
+                /**
+                 * @brief Construct a new pool whose slabs hold a given number of slots.
+                 * @param slab_capacity Number of slots within each slab.
+                 * @exception If the given capacity is zero, a `ValueError` is thrown.
+                 */
+                explicit pool_t(std::size_t slab_capacity);
+
+                pool_t(const pool_t &) = delete;
+                pool_t &operator=(const pool_t &) = delete;
+
+                /**
+                 * @brief Obtain an uninitialised slot large enough to hold a `Type`.
+                 * @returns A pointer to the slot.
+                 * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+                 */
+                Type *allocate(void);
+
+                /**
+                 * @brief Return a slot to the pool. The slot may be returned by any thread, not only the one that allocated it.
+                 * @param slot Slot obtained from `allocate`. Any object within the slot must already be destroyed.
+                 */
+                void deallocate(Type *slot) noexcept;
+
+                /**
+                 * @brief Allocate a slot and construct an object within it.
+                 * @param arguments Arguments forwarded to the constructor of `Type`.
+                 * @returns A pointer to the constructed object.
+                 * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+                 * @exception Any exception thrown by the constructor of `Type` is rethrown once the slot is returned.
+                 */
+                template <typename... Arguments>
+                Type *construct(Arguments &&...arguments);
+
+                /**
+                 * @brief Destroy an object and return its slot to the pool.
+                 * @param object Object obtained from `construct`.
+                 */
+                void destroy(Type *object) noexcept;
+
+                /**
+                 * @brief Free every slab at once. Objects still within the pool are not destroyed, so this is meant for objects that need no destructor or that were all destroyed already. The pool must not be used by any other thread while it is released.
+                 */
+                void release(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of slots within each slab.
+                 * @returns The capacity of a slab.
+                 */
+                std::size_t slab_capacity(void) const noexcept;
+
+                /**
+                 * @brief Obtain the number of slabs allocated by the pool.
+                 * @returns The number of slabs.
+                 */
+                std::size_t slabs(void) const noexcept;
+
+                /**
+                 * @brief Free every slab. Objects still within the pool are not destroyed.
+                 */
+                virtual ~pool_t();
+
+            protected:
+                /**
+                 * @brief Storage of a single slot. A free slot holds the link to the next free slot.
+                 */
+                union slot_t
+                {
+                    slot_t *next;
+                    alignas(Type) unsigned char storage[sizeof(Type)];
+                };
+
+                /**
+                 * @brief Free slots of a pool cached by a single thread.
+                 */
+                using cache_t = pool_cache_t;
+
+                /**
+                 * @brief Obtain the cache of the calling thread for this pool. If the cache belongs to another pool, or to a released epoch, its slots are first returned to their pool.
+                 * @returns A reference to the cache.
+                 */
+                cache_t &_cache(void) noexcept;
+
+                /**
+                 * @brief Splice slots returned by a displaced or exiting cache onto the shared list. Slots of an earlier epoch point into freed slabs, so they are dropped. The mutex of the control must be held.
+                 * @param pool Pool to which to return the slots.
+                 * @param head First of the null-terminated list of slots.
+                 * @param epoch Epoch in which the slots were cached.
+                 */
+                static void _reclaim(void *pool, void *head, std::uint64_t epoch) noexcept;
+
+                /**
+                 * @brief Move a batch of free slots from the shared list into a cache, allocating a new slab if the shared list is empty.
+                 * @param cache Cache to fill.
+                 * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+                 */
+                void _refill(cache_t &cache);
+
+                /**
+                 * @brief Move a batch of free slots from a cache onto the shared list.
+                 * @param cache Cache to drain.
+                 */
+                void _drain(cache_t &cache) noexcept;
+
+                /**
+                 * @brief Free every slab and forget every free slot.
+                 */
+                void _delete(void) noexcept;
+
+            protected:
+                std::uint64_t __id;
+                std::atomic<std::uint64_t> __epoch;
+                std::size_t __slab_capacity;
+                std::shared_ptr<pool_control_t> __control;
+                dynamic_array_t<slot_t *> __slabs;
+                slot_t *__shared;
+        };
+    }
+}
+
+#endif // POOL_HPP
+
+#if defined(POOL_IMPLEMENTATION) && !defined(POOL_IMPLEMENTED)
+#define POOL_IMPLEMENTED
+
+#include <cstdlib> // std::malloc, std::free
+#include <new> // placement new
+#include <utility> // std::forward
+
+#define DYNAMIC_ARRAY_IMPLEMENTATION
+#include "dynamic_array.hpp"
+
+#ifndef POOL_SLAB_CAPACITY
+#define POOL_SLAB_CAPACITY 1024
+#endif // POOL_SLAB_CAPACITY
+
+#ifndef POOL_BATCH_SIZE
+#define POOL_BATCH_SIZE 32
+#endif // POOL_BATCH_SIZE
+
+#ifndef POOL_THREAD_CACHES
+#define POOL_THREAD_CACHES 16
+#endif // POOL_THREAD_CACHES
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Obtain a new pool identifier, which spreads pools over the caches of a thread.
+         * @returns A unique identifier.
+         */
+        inline std::uint64_t __pool_next_id(void) noexcept
+        {
+            static std::atomic<std::uint64_t> next(1);
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Obtain the cache table of the calling thread. The table is shared by every pool and is indexed by pool identifier.
+         * @returns A pointer to the first of `POOL_THREAD_CACHES` caches.
+         */
+        inline pool_cache_t *__pool_thread_caches(void) noexcept
+        {
+            thread_local pool_cache_t caches[POOL_THREAD_CACHES] = {};
+            return caches;
+        }
+
+        /**
+         * @brief Return every cached slot to the pool that owns them, unless it has since been destroyed or released, and empty the cache.
+         */
+        inline void pool_cache_t::flush(void) noexcept
+        {
+            if (nullptr != control && nullptr != head)
+            {
+                std::lock_guard<std::mutex> lock(control->mutex);
+                if (nullptr != control->pool)
+                {
+                    control->reclaim(control->pool, head, epoch);
+                }
+            }
+            head = nullptr;
+            count = 0;
+        }
+
+        /**
+         * @brief Return every cached slot to its pool when the thread exits.
+         */
+        inline pool_cache_t::~pool_cache_t()
+        {
+            flush();
+        }
+
+        /**
+         * @brief Construct a new pool whose slabs hold a default number of slots.
+         */
+        template <typename Type>
+        pool_t<Type>::pool_t(void) : __id(__pool_next_id()), __epoch(0), __slab_capacity(POOL_SLAB_CAPACITY), __control(std::make_shared<pool_control_t>()), __slabs(), __shared(nullptr)
+        {
+            static_assert(alignof(Type) <= alignof(std::max_align_t), "The slots of a pool can not be aligned beyond `std::max_align_t`.");
+            __control->pool = this;
+            __control->reclaim = &pool_t<Type>::_reclaim;
+        }
+
+        /**
+         * @brief Construct a new pool whose slabs hold a given number of slots.
+         * @param slab_capacity Number of slots within each slab.
+         * @exception If the given capacity is zero, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        pool_t<Type>::pool_t(std::size_t slab_capacity) : __id(__pool_next_id()), __epoch(0), __slab_capacity(slab_capacity), __control(std::make_shared<pool_control_t>()), __slabs(), __shared(nullptr)
+        {
+            static_assert(alignof(Type) <= alignof(std::max_align_t), "The slots of a pool can not be aligned beyond `std::max_align_t`.");
+            if (0 == slab_capacity)
+            {
+                throw ValueError("Can not construct a pool with a slab capacity of zero.");
+            }
+            __control->pool = this;
+            __control->reclaim = &pool_t<Type>::_reclaim;
+        }
+
+        /**
+         * @brief Obtain an uninitialised slot large enough to hold a `Type`.
+         * @returns A pointer to the slot.
+         * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        Type *pool_t<Type>::allocate(void)
+        {
+            cache_t &cache = _cache();
+            if (nullptr == cache.head)
+            {
+                _refill(cache);
+            }
+            slot_t *slot = static_cast<slot_t *>(cache.head);
+            cache.head = slot->next;
+            cache.count--;
+            return reinterpret_cast<Type *>(slot->storage);
+        }
+
+        /**
+         * @brief Return a slot to the pool. The slot may be returned by any thread, not only the one that allocated it.
+         * @param slot Slot obtained from `allocate`. Any object within the slot must already be destroyed.
+         */
+        template <typename Type>
+        void pool_t<Type>::deallocate(Type *slot) noexcept
+        {
+            if (nullptr == slot)
+            {
+                return;
+            }
+            cache_t &cache = _cache();
+            slot_t *free = reinterpret_cast<slot_t *>(slot);
+            free->next = static_cast<slot_t *>(cache.head);
+            cache.head = free;
+            cache.count++;
+            if (cache.count >= 2 * POOL_BATCH_SIZE)
+            {
+                _drain(cache);
+            }
+        }
+
+        /**
+         * @brief Allocate a slot and construct an object within it.
+         * @param arguments Arguments forwarded to the constructor of `Type`.
+         * @returns A pointer to the constructed object.
+         * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+         * @exception Any exception thrown by the constructor of `Type` is rethrown once the slot is returned.
+         */
+        template <typename Type>
+        template <typename... Arguments>
+        Type *pool_t<Type>::construct(Arguments &&...arguments)
+        {
+            Type *slot = allocate();
+            try
+            {
+                return new (slot) Type(std::forward<Arguments>(arguments)...);
+            }
+            catch (...)
+            {
+                deallocate(slot);
+                throw;
+            }
+        }
+
+        /**
+         * @brief Destroy an object and return its slot to the pool.
+         * @param object Object obtained from `construct`.
+         */
+        template <typename Type>
+        void pool_t<Type>::destroy(Type *object) noexcept
+        {
+            if (nullptr == object)
+            {
+                return;
+            }
+            object->~Type();
+            deallocate(object);
+        }
+
+        /**
+         * @brief Free every slab at once. Objects still within the pool are not destroyed, so this is meant for objects that need no destructor or that were all destroyed already. The pool must not be used by any other thread while it is released.
+         */
+        template <typename Type>
+        void pool_t<Type>::release(void) noexcept
+        {
+            std::lock_guard<std::mutex> lock(__control->mutex);
+            _delete();
+            // Bumping the epoch invalidates the caches of every thread, since they point into the freed slabs.
+            __epoch.fetch_add(1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Obtain the number of slots within each slab.
+         * @returns The capacity of a slab.
+         */
+        template <typename Type>
+        std::size_t pool_t<Type>::slab_capacity(void) const noexcept
+        {
+            return __slab_capacity;
+        }
+
+        /**
+         * @brief Obtain the number of slabs allocated by the pool.
+         * @returns The number of slabs.
+         */
+        template <typename Type>
+        std::size_t pool_t<Type>::slabs(void) const noexcept
+        {
+            return __slabs.size();
+        }
+
+        /**
+         * @brief Free every slab. Objects still within the pool are not destroyed.
+         */
+        template <typename Type>
+        pool_t<Type>::~pool_t()
+        {
+            {
+                // Caches still holding slots of this pool find it gone, and drop them.
+                std::lock_guard<std::mutex> lock(__control->mutex);
+                __control->pool = nullptr;
+            }
+            _delete();
+        }
+
+        /**
+         * @brief Obtain the cache of the calling thread for this pool, discarding it if it belongs to another pool or to a released epoch.
+         * @returns A reference to the cache.
+         */
+        template <typename Type>
+        typename pool_t<Type>::cache_t &pool_t<Type>::_cache(void) noexcept
+        {
+            cache_t &cache = __pool_thread_caches()[__id % POOL_THREAD_CACHES];
+            const std::uint64_t epoch = __epoch.load(std::memory_order_acquire);
+            if (cache.control != __control || cache.epoch != epoch)
+            {
+                // The control is kept alive by the cache, so it can not be mistaken for that of a later pool at the same address.
+                cache.flush();
+                cache.control = __control;
+                cache.epoch = epoch;
+            }
+            return cache;
+        }
+
+        /**
+         * @brief Splice slots returned by a displaced or exiting cache onto the shared list. Slots of an earlier epoch point into freed slabs, so they are dropped. The mutex of the control must be held.
+         * @param pool Pool to which to return the slots.
+         * @param head First of the null-terminated list of slots.
+         * @param epoch Epoch in which the slots were cached.
+         */
+        template <typename Type>
+        void pool_t<Type>::_reclaim(void *pool, void *head, std::uint64_t epoch) noexcept
+        {
+            pool_t<Type> *self = static_cast<pool_t<Type> *>(pool);
+            if (epoch != self->__epoch.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            slot_t *first = static_cast<slot_t *>(head);
+            slot_t *last = first;
+            while (nullptr != last->next)
+            {
+                last = last->next;
+            }
+            last->next = self->__shared;
+            self->__shared = first;
+        }
+
+        /**
+         * @brief Move a batch of free slots from the shared list into a cache, allocating a new slab if the shared list is empty.
+         * @param cache Cache to fill.
+         * @exception If a new slab can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type>
+        void pool_t<Type>::_refill(cache_t &cache)
+        {
+            std::lock_guard<std::mutex> lock(__control->mutex);
+            if (nullptr == __shared)
+            {
+                slot_t *slab = static_cast<slot_t *>(std::malloc(sizeof(slot_t) * __slab_capacity));
+                if (nullptr == slab)
+                {
+                    throw AllocationError("Can not allocate enough memory for the pool.");
+                }
+                __slabs.append(slab);
+                for (std::size_t i = 0; i + 1 < __slab_capacity; ++i)
+                {
+                    slab[i].next = &slab[i + 1];
+                }
+                slab[__slab_capacity - 1].next = nullptr;
+                __shared = slab;
+            }
+            for (std::size_t i = 0; i < POOL_BATCH_SIZE && nullptr != __shared; ++i)
+            {
+                slot_t *slot = __shared;
+                __shared = slot->next;
+                slot->next = static_cast<slot_t *>(cache.head);
+                cache.head = slot;
+                cache.count++;
+            }
+        }
+
+        /**
+         * @brief Move a batch of free slots from a cache onto the shared list.
+         * @param cache Cache to drain.
+         */
+        template <typename Type>
+        void pool_t<Type>::_drain(cache_t &cache) noexcept
+        {
+            // The batch is detached without the lock, so the critical section is a single splice.
+            slot_t *first = static_cast<slot_t *>(cache.head);
+            slot_t *last = first;
+            for (std::size_t i = 1; i < POOL_BATCH_SIZE; ++i)
+            {
+                last = last->next;
+            }
+            cache.head = last->next;
+            cache.count -= POOL_BATCH_SIZE;
+            std::lock_guard<std::mutex> lock(__control->mutex);
+            last->next = __shared;
+            __shared = first;
+        }
+
+        /**
+         * @brief Free every slab and forget every free slot.
+         */
+        template <typename Type>
+        void pool_t<Type>::_delete(void) noexcept
+        {
+            for (std::size_t i = 0; i < __slabs.size(); ++i)
+            {
+                std::free(__slabs.data()[i]);
+            }
+            __slabs.clear();
+            __shared = nullptr;
+        }
+    }
+}
+
+#endif // POOL_IMPLEMENTATION
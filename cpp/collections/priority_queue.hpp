@@ -0,0 +1,484 @@
+#ifndef PRIORITY_QUEUE_HPP
+#define PRIORITY_QUEUE_HPP
+
+#include <cstddef> // std::size_t
+#include <functional> // std::less
+#include <type_traits> // std::is_trivially_copyable
+
+#include "dynamic_array.hpp" // dynamic_array_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Priority queue stored as a d-ary heap within contiguous memory. A wider heap is shallower than a binary heap, and the children of an item share a cache line, so fewer cache misses are taken per operation. As with `std::priority_queue`, the top of the queue is the greatest item according to the comparison.
+         */
+        template <typename Type, typename Compare = std::less<Type>, std::size_t D = 4>
+        struct priority_queue_t : public sized_t
+        {
+            static_assert(std::is_trivially_copyable<Type>::value, "The type of a priority queue must be trivially copyable.");
+
+            public:
+                /**
+                 * @brief Handle of an item within the queue, through which its priority can later be changed.
+                 */
+                using handle_t = std::size_t;
+
+                /**
+                 * @brief Construct a new empty queue.
+                 * @exception If the queue can not be allocated, an `AllocationError` is thrown.
+                 */
+                priority_queue_t(void);
+
+                /**
+                 * @brief Construct a new empty queue with a given initial capacity.
+                 * @param capacity Initial capacity of the queue.
+                 * @exception If the given capacity is zero, a `ValueError` is thrown.
+                 * @exception If the queue can not be allocated, an `AllocationError` is thrown.
+                 */
+                explicit priority_queue_t(std::size_t capacity);
+
+                priority_queue_t(const priority_queue_t &) = delete;
+                priority_queue_t &operator=(const priority_queue_t &) = delete;
+
+                /**
+                 * @brief Push an item onto the queue.
+                 * @param item Item to push.
+                 * @returns A handle to the item, which remains valid until the item is popped.
+                 * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+                 */
+                handle_t push(Type item);
+
+                /**
+                 * @brief Pop the item at the top of the queue.
+                 * @returns The item at the top of the queue.
+                 * @exception If the queue is evaluated to be empty, a `ValueError` is thrown.
+                 */
+                Type pop(void);
+
+                /**
+                 * @brief Obtain the item at the top of the queue.
+                 * @returns A pointer to the item at the top of the queue, or `nullptr` if the queue is empty.
+                 */
+                const Type *top(void) const noexcept;
+
+                /**
+                 * @brief Push a range of items onto the queue at once. The heap is rebuilt bottom-up in linear time rather than sifting every item.
+                 * @param items Pointer to the first item.
+                 * @param count Number of items within the range.
+                 * @param handles Optional pointer to at least `count` handles, into which the handle of every item is written.
+                 * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void heapify(const Type *items, std::size_t count, handle_t *handles = nullptr);
+
+                /**
+                 * @brief Change the priority of an item. This is the decrease-key operation; the item is sifted towards the top or the bottom of the queue as its new value requires.
+                 * @param handle Handle of the item.
+                 * @param item New value of the item.
+                 * @exception If the handle does not refer to an item within the queue, a `ValueError` is thrown.
+                 */
+                void update(handle_t handle, Type item);
+
+                /**
+                 * @brief Determine if a handle refers to an item within the queue.
+                 * @param handle Handle of the item.
+                 * @returns True if the item is within the queue, else false.
+                 */
+                bool contains(handle_t handle) const noexcept;
+
+                /**
+                 * @brief Ensure the queue can hold at least a given number of items.
+                 * @param capacity Minimum capacity of the queue.
+                 * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void reserve(std::size_t capacity);
+
+                /**
+                 * @brief Remove every item from the queue. Every handle is invalidated.
+                 */
+                void clear(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of items within the queue.
+                 * @returns The size of the queue.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the queue is empty.
+                 * @returns True if the queue is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the queue is full.
+                 * @returns True if the size of the queue is greater than or equal to its capacity.
+                 */
+                bool is_full(void) const noexcept override;
+
+            protected:
+                /**
+                 * @brief Allocate a handle, reusing a released handle where possible.
+                 * @returns An unused handle.
+                 * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+                 */
+                handle_t _acquire(void);
+
+                /**
+                 * @brief Move an item towards the top of the heap until its parent is not less than it.
+                 * @param index Index of the item within the heap.
+                 * @param item Value of the item.
+                 * @param handle Handle of the item.
+                 */
+                void _sift_up(std::size_t index, Type item, handle_t handle) noexcept;
+
+                /**
+                 * @brief Move an item towards the bottom of the heap until none of its children are greater than it.
+                 * @param index Index of the item within the heap.
+                 * @param item Value of the item.
+                 * @param handle Handle of the item.
+                 */
+                void _sift_down(std::size_t index, Type item, handle_t handle) noexcept;
+
+                /**
+                 * @brief Store an item at a given index within the heap and record its position.
+                 * @param index Index within the heap.
+                 * @param item Value of the item.
+                 * @param handle Handle of the item.
+                 */
+                void _place(std::size_t index, Type item, handle_t handle) noexcept;
+
+            protected:
+                dynamic_array_t<Type> __items;
+                dynamic_array_t<handle_t> __handles;
+                dynamic_array_t<std::size_t> __positions;
+                dynamic_array_t<handle_t> __released;
+                Compare __compare;
+        };
+    }
+}
+
+#endif // PRIORITY_QUEUE_HPP
+
+#if defined(PRIORITY_QUEUE_IMPLEMENTATION) && !defined(PRIORITY_QUEUE_IMPLEMENTED)
+#define PRIORITY_QUEUE_IMPLEMENTED
+
+#define DYNAMIC_ARRAY_IMPLEMENTATION
+#include "dynamic_array.hpp"
+
+namespace
+{
+    /**
+     * @brief Position of a handle whose item is not within the queue.
+     */
+    constexpr std::size_t __PRIORITY_QUEUE_RELEASED = static_cast<std::size_t>(-1);
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty queue.
+         * @exception If the queue can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        priority_queue_t<Type, Compare, D>::priority_queue_t(void) : __items(), __handles(), __positions(), __released(), __compare()
+        {
+            static_assert(D >= 2, "A priority queue must have at least two children per item.");
+        }
+
+        /**
+         * @brief Construct a new empty queue with a given initial capacity.
+         * @param capacity Initial capacity of the queue.
+         * @exception If the given capacity is zero, a `ValueError` is thrown.
+         * @exception If the queue can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        priority_queue_t<Type, Compare, D>::priority_queue_t(std::size_t capacity) : __items(capacity == 0 ? 1 : capacity), __handles(capacity == 0 ? 1 : capacity), __positions(capacity == 0 ? 1 : capacity), __released(), __compare()
+        {
+            static_assert(D >= 2, "A priority queue must have at least two children per item.");
+            if (0 == capacity)
+            {
+                throw ValueError("Can not construct a queue with a capacity of zero.");
+            }
+        }
+
+        /**
+         * @brief Push an item onto the queue.
+         * @param item Item to push.
+         * @returns A handle to the item, which remains valid until the item is popped.
+         * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        typename priority_queue_t<Type, Compare, D>::handle_t priority_queue_t<Type, Compare, D>::push(Type item)
+        {
+            const handle_t handle = _acquire();
+            __items.append(item);
+            __handles.append(handle);
+            _sift_up(size() - 1, item, handle);
+            return handle;
+        }
+
+        /**
+         * @brief Pop the item at the top of the queue.
+         * @returns The item at the top of the queue.
+         * @exception If the queue is evaluated to be empty, a `ValueError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        Type priority_queue_t<Type, Compare, D>::pop(void)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not pop an item from an empty queue.");
+            }
+            Type top = __items.data()[0];
+            const handle_t handle = __handles.data()[0];
+            const std::size_t last = size() - 1;
+            const Type item = __items.data()[last];
+            const handle_t moved = __handles.data()[last];
+            __items.remove(last);
+            __handles.remove(last);
+            __positions.data()[handle] = __PRIORITY_QUEUE_RELEASED;
+            __released.append(handle);
+            if (last > 0)
+            {
+                _sift_down(0, item, moved);
+            }
+            return top;
+        }
+
+        /**
+         * @brief Obtain the item at the top of the queue.
+         * @returns A pointer to the item at the top of the queue, or `nullptr` if the queue is empty.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        const Type *priority_queue_t<Type, Compare, D>::top(void) const noexcept
+        {
+            return is_empty() ? nullptr : __items.data();
+        }
+
+        /**
+         * @brief Push a range of items onto the queue at once. The heap is rebuilt bottom-up in linear time rather than sifting every item.
+         * @param items Pointer to the first item.
+         * @param count Number of items within the range.
+         * @param handles Optional pointer to at least `count` handles, into which the handle of every item is written.
+         * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::heapify(const Type *items, std::size_t count, handle_t *handles)
+        {
+            if (0 == count)
+            {
+                return;
+            }
+            reserve(size() + count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const handle_t handle = _acquire();
+                __positions.data()[handle] = size();
+                __items.append(items[i]);
+                __handles.append(handle);
+                if (nullptr != handles)
+                {
+                    handles[i] = handle;
+                }
+            }
+            if (size() < 2)
+            {
+                return;
+            }
+            // Every item past the parent of the last item is a leaf, so only the parents need to be sifted.
+            for (std::size_t index = (size() - 2) / D + 1; index-- > 0;)
+            {
+                _sift_down(index, __items.data()[index], __handles.data()[index]);
+            }
+        }
+
+        /**
+         * @brief Change the priority of an item. This is the decrease-key operation; the item is sifted towards the top or the bottom of the queue as its new value requires.
+         * @param handle Handle of the item.
+         * @param item New value of the item.
+         * @exception If the handle does not refer to an item within the queue, a `ValueError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::update(handle_t handle, Type item)
+        {
+            if (!contains(handle))
+            {
+                throw ValueError("Can not update an item that is not within the queue.");
+            }
+            const std::size_t index = __positions.data()[handle];
+            if (__compare(__items.data()[index], item))
+            {
+                _sift_up(index, item, handle);
+            }
+            else
+            {
+                _sift_down(index, item, handle);
+            }
+        }
+
+        /**
+         * @brief Determine if a handle refers to an item within the queue.
+         * @param handle Handle of the item.
+         * @returns True if the item is within the queue, else false.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        bool priority_queue_t<Type, Compare, D>::contains(handle_t handle) const noexcept
+        {
+            return handle < __positions.size() && __positions.data()[handle] != __PRIORITY_QUEUE_RELEASED;
+        }
+
+        /**
+         * @brief Ensure the queue can hold at least a given number of items.
+         * @param capacity Minimum capacity of the queue.
+         * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::reserve(std::size_t capacity)
+        {
+            __items.reserve(capacity);
+            __handles.reserve(capacity);
+            __positions.reserve(capacity);
+        }
+
+        /**
+         * @brief Remove every item from the queue. Every handle is invalidated.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::clear(void) noexcept
+        {
+            __items.clear();
+            __handles.clear();
+            __positions.clear();
+            __released.clear();
+        }
+
+        /**
+         * @brief Obtain the number of items within the queue.
+         * @returns The size of the queue.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        std::size_t priority_queue_t<Type, Compare, D>::size(void) const noexcept
+        {
+            return __items.size();
+        }
+
+        /**
+         * @brief Determine if the queue is empty.
+         * @returns True if the queue is determined to be empty, else false.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        bool priority_queue_t<Type, Compare, D>::is_empty(void) const noexcept
+        {
+            return __items.size() == 0;
+        }
+
+        /**
+         * @brief Determine if the queue is full.
+         * @returns True if the size of the queue is greater than or equal to its capacity.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        bool priority_queue_t<Type, Compare, D>::is_full(void) const noexcept
+        {
+            return __items.is_full();
+        }
+
+        /**
+         * @brief Allocate a handle, reusing a released handle where possible.
+         * @returns An unused handle.
+         * @exception If the queue can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        typename priority_queue_t<Type, Compare, D>::handle_t priority_queue_t<Type, Compare, D>::_acquire(void)
+        {
+            if (!__released.is_empty())
+            {
+                const handle_t handle = __released.data()[__released.size() - 1];
+                __released.remove(__released.size() - 1);
+                return handle;
+            }
+            __positions.append(__PRIORITY_QUEUE_RELEASED);
+            return __positions.size() - 1;
+        }
+
+        /**
+         * @brief Move an item towards the top of the heap until its parent is not less than it.
+         * @param index Index of the item within the heap.
+         * @param item Value of the item.
+         * @param handle Handle of the item.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::_sift_up(std::size_t index, Type item, handle_t handle) noexcept
+        {
+            Type *items = __items.data();
+            // The item is held aside and its parents are moved down into the hole, rather than swapped.
+            while (index > 0)
+            {
+                const std::size_t parent = (index - 1) / D;
+                if (!__compare(items[parent], item))
+                {
+                    break;
+                }
+                _place(index, items[parent], __handles.data()[parent]);
+                index = parent;
+            }
+            _place(index, item, handle);
+        }
+
+        /**
+         * @brief Move an item towards the bottom of the heap until none of its children are greater than it.
+         * @param index Index of the item within the heap.
+         * @param item Value of the item.
+         * @param handle Handle of the item.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::_sift_down(std::size_t index, Type item, handle_t handle) noexcept
+        {
+            Type *items = __items.data();
+            const std::size_t length = size();
+            while (true)
+            {
+                const std::size_t first = index * D + 1;
+                if (first >= length)
+                {
+                    break;
+                }
+                const std::size_t last = first + D < length ? first + D : length;
+                std::size_t best = first;
+                for (std::size_t child = first + 1; child < last; ++child)
+                {
+                    if (__compare(items[best], items[child]))
+                    {
+                        best = child;
+                    }
+                }
+                if (!__compare(item, items[best]))
+                {
+                    break;
+                }
+                _place(index, items[best], __handles.data()[best]);
+                index = best;
+            }
+            _place(index, item, handle);
+        }
+
+        /**
+         * @brief Store an item at a given index within the heap and record its position.
+         * @param index Index within the heap.
+         * @param item Value of the item.
+         * @param handle Handle of the item.
+         */
+        template <typename Type, typename Compare, std::size_t D>
+        void priority_queue_t<Type, Compare, D>::_place(std::size_t index, Type item, handle_t handle) noexcept
+        {
+            __items.data()[index] = item;
+            __handles.data()[index] = handle;
+            __positions.data()[handle] = index;
+        }
+    }
+}
+
+#endif // PRIORITY_QUEUE_IMPLEMENTATION
@@ -0,0 +1,404 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <vector> // std::vector
+
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Table of values addressed by stable handles. The values are stored densely for fast iteration, while a sparse table of slots maps every handle to its value. A handle holds the index of its slot and the generation of the slot, so a handle to a removed value is never mistaken for a later one.
+         */
+        template <typename Type>
+        struct slot_map_t : public sized_t
+        {
+            public:
+                /**
+                 * @brief Handle of a value. The lower 32 bits hold the index of a slot and the upper 32 bits hold its generation. A handle of zero never refers to a value.
+                 */
+                using handle_t = std::uint64_t;
+
+                /**
+                 * @brief Construct a new empty map.
+                 */
+                slot_map_t(void);
+
+                slot_map_t(const slot_map_t &) = delete;
+                slot_map_t &operator=(const slot_map_t &) = delete;
+
+                /**
+                 * @brief Insert a value into the map.
+                 * @param value Value to insert.
+                 * @returns A handle to the value, which remains valid until the value is removed.
+                 * @exception If the map already holds the greatest number of slots a handle can address, an `OutOfRangeError` is thrown.
+                 */
+                handle_t insert(Type value);
+
+                /**
+                 * @brief Remove the value of a given handle. The last value is moved into its place, so the dense order of the values is not preserved.
+                 * @param handle Handle of the value.
+                 * @exception If the handle does not refer to a value within the map, a `ValueError` is thrown.
+                 */
+                void remove(handle_t handle);
+
+                /**
+                 * @brief Obtain the value of a given handle.
+                 * @param handle Handle of the value.
+                 * @returns A mutable pointer to the value.
+                 * @exception If the handle does not refer to a value within the map, a `ValueError` is thrown.
+                 */
+                Type *at(handle_t handle) const;
+
+                /**
+                 * @brief Search for the value of a given handle.
+                 * @param handle Handle of the value.
+                 * @returns A mutable pointer to the value, or `nullptr` if the handle does not refer to a value within the map.
+                 */
+                Type *find(handle_t handle) const noexcept;
+
+                /**
+                 * @brief Determine if a handle refers to a value within the map.
+                 * @param handle Handle of the value.
+                 * @returns True if the value is within the map, else false.
+                 */
+                bool contains(handle_t handle) const noexcept;
+
+                /**
+                 * @brief Obtain the dense values of the map. The values are contiguous and hold `size()` items, in no particular order.
+                 * @returns A mutable pointer to the first value.
+                 */
+                Type *values(void) const noexcept;
+
+                /**
+                 * @brief Obtain the handle of a value from its position within the dense values.
+                 * @param index Position of the value within the dense values.
+                 * @returns The handle of the value.
+                 * @exception If the given index is greater than or equal to the size of the map, an `IndexError` is thrown.
+                 */
+                handle_t handle_at(std::size_t index) const;
+
+                /**
+                 * @brief Call a given function for every value within the map, in dense order.
+                 * @param function Callable taking a `handle_t` and a `Type &`.
+                 */
+                template <typename Function>
+                void for_each(Function function) const;
+
+                /**
+                 * @brief Ensure the map can hold at least a given number of values without reallocating.
+                 * @param capacity Minimum capacity of the map.
+                 */
+                void reserve(std::size_t capacity);
+
+                /**
+                 * @brief Remove every value from the map. Every handle is invalidated.
+                 */
+                void clear(void) noexcept;
+
+                /**
+                 * @brief Obtain the number of values within the map.
+                 * @returns The size of the map.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the map is empty.
+                 * @returns True if the map is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the map is full.
+                 * @returns True if the map holds the greatest number of slots a handle can address and none are free.
+                 */
+                bool is_full(void) const noexcept override;
+
+            protected:
+                /**
+                 * @brief Sparse entry of the map. An occupied slot holds the position of its value within the dense values; a free slot holds the index of the next free slot.
+                 */
+                struct slot_t
+                {
+                    std::uint32_t index;
+                    std::uint32_t generation;
+                };
+
+                /**
+                 * @brief Obtain the slot of a handle if the handle is current.
+                 * @param handle Handle of the value.
+                 * @returns A pointer to the slot, or `nullptr` if the handle does not refer to a value within the map.
+                 */
+                const slot_t *_slot(handle_t handle) const noexcept;
+
+            protected:
+                mutable std::vector<Type> __values;
+                std::vector<std::uint32_t> __owners;
+                std::vector<slot_t> __slots;
+                std::uint32_t __free;
+        };
+    }
+}
+
+#endif // SLOT_MAP_HPP
+
+#if defined(SLOT_MAP_IMPLEMENTATION) && !defined(SLOT_MAP_IMPLEMENTED)
+#define SLOT_MAP_IMPLEMENTED
+
+#include <utility> // std::move
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+namespace
+{
+    /**
+     * @brief Index of a slot that does not exist; terminates the free list.
+     */
+    constexpr std::uint32_t __SLOT_MAP_NONE = 0xFFFFFFFFu;
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new empty map.
+         */
+        template <typename Type>
+        slot_map_t<Type>::slot_map_t(void) : __values(), __owners(), __slots(), __free(__SLOT_MAP_NONE) {}
+
+        /**
+         * @brief Insert a value into the map.
+         * @param value Value to insert.
+         * @returns A handle to the value, which remains valid until the value is removed.
+         * @exception If the map already holds the greatest number of slots a handle can address, an `OutOfRangeError` is thrown.
+         */
+        template <typename Type>
+        typename slot_map_t<Type>::handle_t slot_map_t<Type>::insert(Type value)
+        {
+            std::uint32_t slot = __free;
+            if (__SLOT_MAP_NONE == slot)
+            {
+                if (is_full())
+                {
+                    throw OutOfRangeError("Can not insert into a slot map of %zu slots.", __slots.size());
+                }
+                slot = static_cast<std::uint32_t>(__slots.size());
+                // Generations start at one so that a handle of zero never refers to a value.
+                __slots.push_back(slot_t{0, 1});
+            }
+            else
+            {
+                __free = __slots[slot].index;
+            }
+            __values.push_back(std::move(value));
+            __owners.push_back(slot);
+            __slots[slot].index = static_cast<std::uint32_t>(__values.size() - 1);
+            return (static_cast<handle_t>(__slots[slot].generation) << 32) | slot;
+        }
+
+        /**
+         * @brief Remove the value of a given handle. The last value is moved into its place, so the dense order of the values is not preserved.
+         * @param handle Handle of the value.
+         * @exception If the handle does not refer to a value within the map, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        void slot_map_t<Type>::remove(handle_t handle)
+        {
+            if (nullptr == _slot(handle))
+            {
+                throw ValueError("Can not remove a handle that does not refer to a value within the slot map.");
+            }
+            const std::uint32_t slot = static_cast<std::uint32_t>(handle);
+            const std::uint32_t index = __slots[slot].index;
+            const std::uint32_t last = static_cast<std::uint32_t>(__values.size() - 1);
+            if (index != last)
+            {
+                __values[index] = std::move(__values[last]);
+                __owners[index] = __owners[last];
+                __slots[__owners[index]].index = index;
+            }
+            __values.pop_back();
+            __owners.pop_back();
+            // Bumping the generation invalidates every outstanding handle to the slot.
+            __slots[slot].generation++;
+            if (0 == __slots[slot].generation)
+            {
+                __slots[slot].generation = 1;
+            }
+            __slots[slot].index = __free;
+            __free = slot;
+        }
+
+        /**
+         * @brief Obtain the value of a given handle.
+         * @param handle Handle of the value.
+         * @returns A mutable pointer to the value.
+         * @exception If the handle does not refer to a value within the map, a `ValueError` is thrown.
+         */
+        template <typename Type>
+        Type *slot_map_t<Type>::at(handle_t handle) const
+        {
+            Type *value = find(handle);
+            if (nullptr == value)
+            {
+                throw ValueError("Can not access a handle that does not refer to a value within the slot map.");
+            }
+            return value;
+        }
+
+        /**
+         * @brief Search for the value of a given handle.
+         * @param handle Handle of the value.
+         * @returns A mutable pointer to the value, or `nullptr` if the handle does not refer to a value within the map.
+         */
+        template <typename Type>
+        Type *slot_map_t<Type>::find(handle_t handle) const noexcept
+        {
+            const slot_t *slot = _slot(handle);
+            return nullptr == slot ? nullptr : &__values[slot->index];
+        }
+
+        /**
+         * @brief Determine if a handle refers to a value within the map.
+         * @param handle Handle of the value.
+         * @returns True if the value is within the map, else false.
+         */
+        template <typename Type>
+        bool slot_map_t<Type>::contains(handle_t handle) const noexcept
+        {
+            return nullptr != _slot(handle);
+        }
+
+        /**
+         * @brief Obtain the dense values of the map. The values are contiguous and hold `size()` items, in no particular order.
+         * @returns A mutable pointer to the first value.
+         */
+        template <typename Type>
+        Type *slot_map_t<Type>::values(void) const noexcept
+        {
+            return __values.data();
+        }
+
+        /**
+         * @brief Obtain the handle of a value from its position within the dense values.
+         * @param index Position of the value within the dense values.
+         * @returns The handle of the value.
+         * @exception If the given index is greater than or equal to the size of the map, an `IndexError` is thrown.
+         */
+        template <typename Type>
+        typename slot_map_t<Type>::handle_t slot_map_t<Type>::handle_at(std::size_t index) const
+        {
+            if (index >= __values.size())
+            {
+                throw IndexError("Can not access value %zu of a slot map of size %zu.", index, __values.size());
+            }
+            const std::uint32_t slot = __owners[index];
+            return (static_cast<handle_t>(__slots[slot].generation) << 32) | slot;
+        }
+
+        /**
+         * @brief Call a given function for every value within the map, in dense order.
+         * @param function Callable taking a `handle_t` and a `Type &`.
+         */
+        template <typename Type>
+        template <typename Function>
+        void slot_map_t<Type>::for_each(Function function) const
+        {
+            for (std::size_t i = 0; i < __values.size(); ++i)
+            {
+                const std::uint32_t slot = __owners[i];
+                function((static_cast<handle_t>(__slots[slot].generation) << 32) | slot, __values[i]);
+            }
+        }
+
+        /**
+         * @brief Ensure the map can hold at least a given number of values without reallocating.
+         * @param capacity Minimum capacity of the map.
+         */
+        template <typename Type>
+        void slot_map_t<Type>::reserve(std::size_t capacity)
+        {
+            __values.reserve(capacity);
+            __owners.reserve(capacity);
+            __slots.reserve(capacity);
+        }
+
+        /**
+         * @brief Remove every value from the map. Every handle is invalidated.
+         */
+        template <typename Type>
+        void slot_map_t<Type>::clear(void) noexcept
+        {
+            for (std::size_t i = 0; i < __owners.size(); ++i)
+            {
+                slot_t &slot = __slots[__owners[i]];
+                slot.generation = 0 == slot.generation + 1 ? 1 : slot.generation + 1;
+                slot.index = __free;
+                __free = __owners[i];
+            }
+            __values.clear();
+            __owners.clear();
+        }
+
+        /**
+         * @brief Obtain the number of values within the map.
+         * @returns The size of the map.
+         */
+        template <typename Type>
+        std::size_t slot_map_t<Type>::size(void) const noexcept
+        {
+            return __values.size();
+        }
+
+        /**
+         * @brief Determine if the map is empty.
+         * @returns True if the map is determined to be empty, else false.
+         */
+        template <typename Type>
+        bool slot_map_t<Type>::is_empty(void) const noexcept
+        {
+            return __values.empty();
+        }
+
+        /**
+         * @brief Determine if the map is full.
+         * @returns True if the map holds the greatest number of slots a handle can address and none are free.
+         */
+        template <typename Type>
+        bool slot_map_t<Type>::is_full(void) const noexcept
+        {
+            return __SLOT_MAP_NONE == __free && __slots.size() >= __SLOT_MAP_NONE;
+        }
+
+        /**
+         * @brief Obtain the slot of a handle if the handle is current.
+         * @param handle Handle of the value.
+         * @returns A pointer to the slot, or `nullptr` if the handle does not refer to a value within the map.
+         */
+        template <typename Type>
+        const typename slot_map_t<Type>::slot_t *slot_map_t<Type>::_slot(handle_t handle) const noexcept
+        {
+            const std::uint32_t index = static_cast<std::uint32_t>(handle);
+            const std::uint32_t generation = static_cast<std::uint32_t>(handle >> 32);
+            if (index >= __slots.size() || __slots[index].generation != generation)
+            {
+                return nullptr;
+            }
+            const slot_t *slot = &__slots[index];
+            // A free slot keeps its generation, so it must also be checked against its owner to be current.
+            if (slot->index >= __owners.size() || __owners[slot->index] != index)
+            {
+                return nullptr;
+            }
+            return slot;
+        }
+    }
+}
+
+#endif // SLOT_MAP_IMPLEMENTATION
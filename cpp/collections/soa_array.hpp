@@ -0,0 +1,407 @@
+#ifndef SOA_ARRAY_HPP
+#define SOA_ARRAY_HPP
+
+#include <cstddef> // std::size_t
+#include <tuple> // std::tuple, std::tuple_element
+#include <type_traits> // std::is_trivially_copyable
+
+#include "array_view.hpp" // array_view_t
+#include "sized.hpp" // sized_t
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Dynamic structure-of-arrays. Each field of a row is stored within its own contiguous column.
+         */
+        template <typename... Fields>
+        struct soa_array_t : public sized_t
+        {
+            static_assert(sizeof...(Fields) > 0, "A structure-of-arrays requires at least one field.");
+            static_assert((std::is_trivially_copyable<Fields>::value && ...), "Each field of a structure-of-arrays must be trivially copyable.");
+
+            /**
+             * @brief Type of the field stored within the column at a given index.
+             */
+            template <std::size_t Index>
+            using field_t = typename std::tuple_element<Index, std::tuple<Fields...>>::type;
+
+            public:
+                /**
+                 * @brief Construct a new structure-of-arrays with a default capacity.
+                 * @exception If any column can not be allocated, an `AllocationError` is thrown.
+                 */
+                soa_array_t(void);
+
+                /**
+                 * @brief Construct a new structure-of-arrays with a given initial capacity.
+                 * @param capacity Initial capacity of every column.
+                 * @exception If the given capacity is zero, a `ValueError` is thrown.
+                 * @exception If any column can not be allocated, an `AllocationError` is thrown.
+                 */
+                explicit soa_array_t(std::size_t capacity);
+
+                soa_array_t(const soa_array_t &) = delete;
+                soa_array_t &operator=(const soa_array_t &) = delete;
+
+                /**
+                 * @brief Append a row to the structure-of-arrays. Each field is written to the end of its own column. If the columns are full, they are resized by a factor of two.
+                 * @param fields Fields of the row to be appended.
+                 * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void append(Fields... fields);
+
+                /**
+                 * @brief Obtain a row at a given index within the structure-of-arrays.
+                 * @param index Index at which the row is located.
+                 * @returns A tuple of mutable references to each field of the row.
+                 * @exception If the structure-of-arrays is evaluated to be empty, a `ValueError` is thrown.
+                 * @exception If the given index is greater than or equal to the size of the structure-of-arrays, an `IndexError` is thrown.
+                 */
+                std::tuple<Fields &...> at(std::size_t index) const;
+
+                /**
+                 * @brief Obtain the contiguous column of a given field.
+                 * @returns A mutable view of the `size()` elements of the column. The view is invalidated once the columns are resized.
+                 */
+                template <std::size_t Index>
+                array_view_t<field_t<Index>> column(void) const noexcept;
+
+                /**
+                 * @brief Remove a row from the structure-of-arrays at a given index.
+                 * @param index Index at which the row is located.
+                 * @exception If the structure-of-arrays is evaluated to be empty, a `ValueError` is thrown.
+                 * @exception If the given index is greater than or equal to the size of the structure-of-arrays, an `OutOfRangeError` is thrown.
+                 */
+                void remove(std::size_t index);
+
+                /**
+                 * @brief Ensure every column can hold at least a given number of rows.
+                 * @param capacity Minimum capacity of every column.
+                 * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void reserve(std::size_t capacity);
+
+                /**
+                 * @brief Obtain the number of rows within the structure-of-arrays.
+                 * @returns The number of rows within the structure-of-arrays.
+                 */
+                std::size_t size(void) const noexcept override;
+
+                /**
+                 * @brief Obtain the number of rows the columns can hold before being resized.
+                 * @returns The capacity of the structure-of-arrays.
+                 */
+                std::size_t capacity(void) const noexcept;
+
+                /**
+                 * @brief Determine if the structure-of-arrays is empty.
+                 * @returns True if the structure-of-arrays is determined to be empty, else false.
+                 */
+                bool is_empty(void) const noexcept override;
+
+                /**
+                 * @brief Determine if the structure-of-arrays is full.
+                 * @returns True if the size of the structure-of-arrays is greater than or equal to its capacity.
+                 */
+                bool is_full(void) const noexcept override;
+
+                /**
+                 * @brief Destructor to cleanup every column.
+                 */
+                virtual ~soa_array_t();
+
+            protected:
+                /**
+                 * @brief Resize every column by a factor of two.
+                 * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void _resize(void);
+
+                /**
+                 * @brief Reallocate every column to a given capacity.
+                 * @param capacity Capacity to which to reallocate.
+                 * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+                 */
+                void _reallocate(std::size_t capacity);
+
+                /**
+                 * @brief Deallocate every column.
+                 */
+                void _delete(void) noexcept;
+
+            protected:
+                std::tuple<Fields *...> __columns;
+                std::size_t __size;
+                std::size_t __capacity;
+        };
+    }
+}
+
+#endif // SOA_ARRAY_HPP
+
+#if defined(SOA_ARRAY_IMPLEMENTATION) && !defined(SOA_ARRAY_IMPLEMENTED)
+#define SOA_ARRAY_IMPLEMENTED
+
+#include <cstdlib> // std::calloc, std::realloc, std::free
+#include <cstring> // std::memmove
+
+#define ARRAY_VIEW_IMPLEMENTATION
+#include "array_view.hpp"
+
+#define EXCEPTIONS_IMPLEMENTATION
+#include "../exceptions.hpp"
+
+#ifndef SOA_ARRAY_CAPACITY
+#define SOA_ARRAY_CAPACITY 256
+#endif // SOA_ARRAY_CAPACITY
+
+namespace
+{
+    /**
+     * @brief Reallocate a single column to a given capacity.
+     * @param column Column to reallocate.
+     * @param capacity Capacity to which to reallocate.
+     * @returns True if the column has been reallocated, else false. On failure the original column is left untouched.
+     */
+    template <typename Field>
+    bool __soa_reallocate_column(Field *&column, std::size_t capacity) noexcept
+    {
+        Field *temp = static_cast<Field *>(std::realloc(column, capacity * sizeof(Field)));
+        if (nullptr == temp)
+        {
+            return false;
+        }
+        column = temp;
+        return true;
+    }
+}
+
+namespace polutils
+{
+    namespace collections
+    {
+        /**
+         * @brief Construct a new structure-of-arrays with a default capacity.
+         * @exception If any column can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        soa_array_t<Fields...>::soa_array_t(void) : soa_array_t(SOA_ARRAY_CAPACITY) {}
+
+        /**
+         * @brief Construct a new structure-of-arrays with a given initial capacity.
+         * @param capacity Initial capacity of every column.
+         * @exception If the given capacity is zero, a `ValueError` is thrown.
+         * @exception If any column can not be allocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        soa_array_t<Fields...>::soa_array_t(std::size_t capacity) : __columns(), __size(0), __capacity(capacity)
+        {
+            if (0 == capacity)
+            {
+                throw ValueError("Can not construct a structure-of-arrays with a capacity of zero.");
+            }
+            bool allocated = true;
+            std::apply([&](Fields *&...columns)
+            {
+                ((columns = static_cast<Fields *>(std::calloc(__capacity, sizeof(Fields))), allocated = allocated && nullptr != columns), ...);
+            }, __columns);
+            if (!allocated)
+            {
+                _delete();
+                throw AllocationError("Can not allocate enough memory for the structure-of-arrays.");
+            }
+        }
+
+        /**
+         * @brief Append a row to the structure-of-arrays. Each field is written to the end of its own column. If the columns are full, they are resized by a factor of two.
+         * @param fields Fields of the row to be appended.
+         * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::append(Fields... fields)
+        {
+            if (is_full())
+            {
+                _resize();
+            }
+            std::apply([&](Fields *...columns)
+            {
+                ((columns[__size] = fields), ...);
+            }, __columns);
+            __size++;
+        }
+
+        /**
+         * @brief Obtain a row at a given index within the structure-of-arrays.
+         * @param index Index at which the row is located.
+         * @returns A tuple of mutable references to each field of the row.
+         * @exception If the structure-of-arrays is evaluated to be empty, a `ValueError` is thrown.
+         * @exception If the given index is greater than or equal to the size of the structure-of-arrays, an `IndexError` is thrown.
+         */
+        template <typename... Fields>
+        std::tuple<Fields &...> soa_array_t<Fields...>::at(std::size_t index) const
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not access a row of an empty structure-of-arrays.");
+            }
+            else if (index >= __size)
+            {
+                throw IndexError("Can not access row %zu of a structure-of-arrays of size %zu.", index, __size);
+            }
+            return std::apply([index](Fields *...columns)
+            {
+                return std::tuple<Fields &...>(columns[index]...);
+            }, __columns);
+        }
+
+        /**
+         * @brief Obtain the contiguous column of a given field.
+         * @returns A mutable view of the `size()` elements of the column. The view is invalidated once the columns are resized.
+         */
+        template <typename... Fields>
+        template <std::size_t Index>
+        array_view_t<typename soa_array_t<Fields...>::template field_t<Index>> soa_array_t<Fields...>::column(void) const noexcept
+        {
+            return array_view_t<field_t<Index>>(std::get<Index>(__columns), __size);
+        }
+
+        /**
+         * @brief Remove a row from the structure-of-arrays at a given index.
+         * @param index Index at which the row is located.
+         * @exception If the structure-of-arrays is evaluated to be empty, a `ValueError` is thrown.
+         * @exception If the given index is greater than or equal to the size of the structure-of-arrays, an `OutOfRangeError` is thrown.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::remove(std::size_t index)
+        {
+            if (is_empty())
+            {
+                throw ValueError("Can not remove a row from an empty structure-of-arrays.");
+            }
+            else if (index >= __size)
+            {
+                throw OutOfRangeError("Can not access row outside of structure-of-arrays bounds.");
+            }
+            const std::size_t trailing = __size - index - 1;
+            std::apply([&](Fields *...columns)
+            {
+                (std::memmove(columns + index, columns + index + 1, trailing * sizeof(Fields)), ...);
+            }, __columns);
+            __size--;
+        }
+
+        /**
+         * @brief Ensure every column can hold at least a given number of rows.
+         * @param capacity Minimum capacity of every column.
+         * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::reserve(std::size_t capacity)
+        {
+            if (capacity <= __capacity)
+            {
+                return;
+            }
+            _reallocate(capacity);
+        }
+
+        /**
+         * @brief Obtain the number of rows within the structure-of-arrays.
+         * @returns The number of rows within the structure-of-arrays.
+         */
+        template <typename... Fields>
+        std::size_t soa_array_t<Fields...>::size(void) const noexcept
+        {
+            return __size;
+        }
+
+        /**
+         * @brief Obtain the number of rows the columns can hold before being resized.
+         * @returns The capacity of the structure-of-arrays.
+         */
+        template <typename... Fields>
+        std::size_t soa_array_t<Fields...>::capacity(void) const noexcept
+        {
+            return __capacity;
+        }
+
+        /**
+         * @brief Determine if the structure-of-arrays is empty.
+         * @returns True if the structure-of-arrays is determined to be empty, else false.
+         */
+        template <typename... Fields>
+        bool soa_array_t<Fields...>::is_empty(void) const noexcept
+        {
+            return __size == 0;
+        }
+
+        /**
+         * @brief Determine if the structure-of-arrays is full.
+         * @returns True if the size of the structure-of-arrays is greater than or equal to its capacity.
+         */
+        template <typename... Fields>
+        bool soa_array_t<Fields...>::is_full(void) const noexcept
+        {
+            return __size >= __capacity;
+        }
+
+        /**
+         * @brief Resize every column by a factor of two.
+         * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::_resize(void)
+        {
+            _reallocate(__capacity * 2);
+        }
+
+        /**
+         * @brief Reallocate every column to a given capacity.
+         * @param capacity Capacity to which to reallocate.
+         * @exception If any column can not be reallocated, an `AllocationError` is thrown.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::_reallocate(std::size_t capacity)
+        {
+            bool reallocated = true;
+            std::apply([&](Fields *&...columns)
+            {
+                ((reallocated = reallocated && __soa_reallocate_column(columns, capacity)), ...);
+            }, __columns);
+            if (!reallocated)
+            {
+                // Columns that were already grown are still valid; only the capacity is left unchanged.
+                throw AllocationError("Can not resize structure-of-arrays.");
+            }
+            __capacity = capacity;
+        }
+
+        /**
+         * @brief Deallocate every column.
+         */
+        template <typename... Fields>
+        void soa_array_t<Fields...>::_delete(void) noexcept
+        {
+            std::apply([](Fields *&...columns)
+            {
+                ((std::free(columns), columns = nullptr), ...);
+            }, __columns);
+            __capacity = 0;
+            __size = 0;
+        }
+
+        /**
+         * @brief Destructor to cleanup every column.
+         */
+        template <typename... Fields>
+        soa_array_t<Fields...>::~soa_array_t()
+        {
+            _delete();
+        }
+    }
+}
+
+#endif // SOA_ARRAY_IMPLEMENTATION
@@ -72,7 +72,8 @@ namespace polutils
 
 #endif // EXCEPTION_HPP_
 
-#ifdef EXCEPTION_IMPLEMENTATION
+#if defined(EXCEPTION_IMPLEMENTATION) && !defined(EXCEPTION_IMPLEMENTED)
+#define EXCEPTION_IMPLEMENTED
 
 #define BUFFER_IMPLEMENTATION
 #include "../c/collections/buffer.h"
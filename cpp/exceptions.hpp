@@ -170,6 +170,8 @@ namespace polutils
 #endif // EXCEPTIONS_HPP
 
 // #ifdef EXCEPTIONS_IMPLEMENTATION
+#ifndef EXCEPTIONS_IMPLEMENTED
+#define EXCEPTIONS_IMPLEMENTED
 
 namespace polutils
 {
@@ -334,4 +336,5 @@ namespace polutils
     }
 }
 
+#endif // EXCEPTIONS_IMPLEMENTED
 // #endif // EXCEPTIONS_IMPLMENTATION
\ No newline at end of file